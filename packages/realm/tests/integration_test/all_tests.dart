@@ -30,6 +30,7 @@ import '../../../realm_dart/test/realm_set_test.dart' as realm_set_test;
 import '../../../realm_dart/test/realm_test.dart' as realm_test;
 import '../../../realm_dart/test/realm_value_test.dart' as realm_value_test;
 import '../../../realm_dart/test/results_test.dart' as results_test;
+import '../../../realm_dart/test/scheduler_test.dart' as scheduler_test;
 import '../../../realm_dart/test/serialization_test.dart' as serialization_test;
 import '../../../realm_dart/test/session_test.dart' as session_test;
 import '../../../realm_dart/test/subscription_test.dart' as subscription_test;
@@ -70,6 +71,7 @@ void main() {
   group('realm_test.dart', realm_test.main);
   group('realm_value_test.dart', realm_value_test.main);
   group('results_test.dart', results_test.main);
+  group('scheduler_test.dart', scheduler_test.main);
   group('serialization_test.dart', serialization_test.main);
   group('session_test.dart', session_test.main);
   group('subscription_test.dart', subscription_test.main);
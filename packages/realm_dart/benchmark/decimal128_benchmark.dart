@@ -0,0 +1,87 @@
+// Copyright 2026 MongoDB, Inc.
+// SPDX-License-Identifier: Apache-2.0
+
+// Compares the Dart implementation of common Decimal128 operations, and decoding decimals
+// from a realm_value_t, with the native calls they replace.
+// Run with `dart run benchmark/decimal128_benchmark.dart`.
+
+import 'dart:ffi';
+import 'dart:math';
+
+import 'package:realm_dart/src/handles/decimal128.dart';
+import 'package:realm_dart/src/handles/native/decimal128.dart' as native;
+import 'package:realm_dart/src/handles/native/ffi.dart';
+import 'package:realm_dart/src/handles/native/from_native.dart';
+import 'package:realm_dart/src/handles/native/realm_bindings.dart';
+import 'package:realm_dart/src/handles/native/realm_library.dart';
+
+const count = 100000;
+
+Decimal128 fromNative(realm_decimal128_t x) => native.Decimal128Internal.fromNative(x);
+
+realm_decimal128_t toNative(Decimal128 x, Allocator allocator) {
+  final result = allocator<realm_decimal128_t>().ref;
+  (x as native.Decimal128).copyTo(result);
+  return result;
+}
+
+void addAndCompare() {
+  final random = Random(42);
+  final values = [for (var i = 0; i < count; i++) Decimal128.fromInt(random.nextInt(1 << 32) - (1 << 31))];
+
+  using((arena) {
+    final nativeValues = [for (final x in values) toNative(x, arena)];
+
+    final dartClock = Stopwatch()..start();
+    var dartSum = Decimal128.zero;
+    var dartOrder = 0;
+    for (var i = 1; i < count; i++) {
+      dartSum = dartSum + values[i];
+      dartOrder += values[i].compareTo(values[i - 1]);
+    }
+    dartClock.stop();
+
+    final nativeClock = Stopwatch()..start();
+    var nativeSum = nativeValues[0];
+    nativeSum = realmLib.realm_dart_decimal128_subtract(nativeSum, nativeSum);
+    var nativeOrder = 0;
+    for (var i = 1; i < count; i++) {
+      nativeSum = realmLib.realm_dart_decimal128_add(nativeSum, nativeValues[i]);
+      nativeOrder += realmLib.realm_dart_decimal128_compare_to(nativeValues[i], nativeValues[i - 1]);
+    }
+    nativeClock.stop();
+
+    if (dartSum != fromNative(nativeSum) || dartOrder != nativeOrder) {
+      throw StateError('Dart and native results differ');
+    }
+    print('$count adds and compares: Dart ${dartClock.elapsedMicroseconds} us, native ${nativeClock.elapsedMicroseconds} us');
+  });
+}
+
+void decode() {
+  using((arena) {
+    final realmValue = arena<realm_value_t>().ref;
+    realmValue.type = realm_value_type.RLM_TYPE_DECIMAL128;
+    (Decimal128.parse('12345.6789') as native.Decimal128).copyTo(realmValue.values.decimal128);
+
+    final decodeClock = Stopwatch()..start();
+    for (var i = 0; i < count; i++) {
+      realmValue.toPrimitiveValue();
+    }
+    decodeClock.stop();
+
+    // the previous decode path, which copied the struct through a native call first
+    final copyClock = Stopwatch()..start();
+    for (var i = 0; i < count; i++) {
+      fromNative(realmLib.realm_dart_decimal128_copy(realmValue.values.decimal128));
+    }
+    copyClock.stop();
+
+    print('$count decimal decodes: ${decodeClock.elapsedMicroseconds} us, with native copy ${copyClock.elapsedMicroseconds} us');
+  });
+}
+
+void main() {
+  addAndCompare();
+  decode();
+}
@@ -134,6 +134,14 @@ class AppConfiguration {
   /// a more complex networking setup.
   final Client httpClient;
 
+  /// Controls whether the HTTP requests of this app, such as logging in, calling functions and refreshing
+  /// access tokens, are performed by a native transport instead of [httpClient].
+  ///
+  /// The native transport runs on a thread of its own, so the requests don't wait for, or wake, the current
+  /// isolate. Connections are kept alive and reused for requests to the same host. [httpClient] is not used
+  /// when this is set. Only supported on the Dart VM.
+  final bool useNativeHttpTransport;
+
   /// Options for the assorted types of connection timeouts for sync connections opened for this app.
   final SyncTimeoutOptions syncTimeoutOptions;
 
@@ -148,6 +156,7 @@ class AppConfiguration {
     @Deprecated('Use SyncTimeoutOptions.connectTimeout') this.maxConnectionTimeout = const Duration(minutes: 2),
     Client? httpClient,
     this.syncTimeoutOptions = const SyncTimeoutOptions(),
+    this.useNativeHttpTransport = false,
   })  : baseUrl = baseUrl ?? Uri.parse(realmCore.getDefaultBaseUrl()),
         baseFilePath = baseFilePath ?? path.dirname(Configuration.defaultRealmPath),
         httpClient = httpClient ?? defaultClient {
@@ -265,6 +274,15 @@ class App {
 
   /// Returns an instance of [EmailPasswordAuthProvider]
   EmailPasswordAuthProvider get emailPasswordAuthProvider => EmailPasswordAuthProviderInternal.create(this);
+
+  /// Returns the metrics of the HTTP requests this app has made, one entry per method and route.
+  ///
+  /// The metrics are collected natively and shared by all isolates using an [App] with the same
+  /// [AppConfiguration.appId]. Comparing the queue time with the time to first byte tells whether
+  /// a slow request was waiting for the network or for the transport to pick it up, which for the
+  /// default transport means waiting for the isolate to be idle.
+  @experimental
+  List<HttpEndpointMetrics> get httpTransportMetrics => handle.httpTransportMetrics;
 }
 
 /// Specify if and how to persists user objects.
@@ -280,6 +298,47 @@ enum MetadataPersistenceMode {
   disabled,
 }
 
+/// The method of an HTTP request made by an [App].
+/// {@category Application}
+enum HttpMethod {
+  get,
+  post,
+  patch,
+  put,
+  delete,
+}
+
+/// The metrics of the HTTP requests an [App] has made with the same [method] to the same [path].
+///
+/// The [path] is a route rather than the path of each request: segments that look like ids, such as
+/// ObjectIds, UUIDs and numbers, are replaced by `{id}`, and the requests to routes beyond the first
+/// 256 are counted under `{other}`.
+///
+/// The counts cover requests that have completed, and [inFlight] those still running. The byte counts
+/// are those of the request and response bodies. The durations are measured from the moment the
+/// transport receives a request, and their percentiles are rounded up to the next power of two microseconds.
+/// {@category Application}
+typedef HttpEndpointMetrics = ({
+  HttpMethod method,
+  String path,
+  int requestCount,
+  int inFlight,
+  int timeoutCount,
+  int socketErrorCount,
+  int errorCount,
+  int bytesSent,
+  int bytesReceived,
+  Duration queueP50,
+  Duration queueP99,
+  Duration queueMax,
+  Duration firstByteP50,
+  Duration firstByteP99,
+  Duration firstByteMax,
+  Duration latencyP50,
+  Duration latencyP99,
+  Duration latencyMax,
+});
+
 /// @nodoc
 extension AppInternal on App {
   AppHandle get handle => _handle;
@@ -189,6 +189,7 @@ abstract class Configuration {
     ShouldCompactCallback? shouldCompactCallback,
     int schemaVersion = 0,
     bool cancelAsyncOperationsOnNonFatalErrors = false,
+    bool openOnNativeEventLoop = false,
   }) =>
       FlexibleSyncConfiguration._(
         user,
@@ -202,6 +203,7 @@ abstract class Configuration {
         shouldCompactCallback: shouldCompactCallback,
         schemaVersion: schemaVersion,
         cancelAsyncOperationsOnNonFatalErrors: cancelAsyncOperationsOnNonFatalErrors,
+        openOnNativeEventLoop: openOnNativeEventLoop,
       );
 
   /// Constructs a [DisconnectedSyncConfiguration]
@@ -362,6 +364,15 @@ class FlexibleSyncConfiguration extends Configuration {
   /// may take an indeterminate time to complete.
   final bool cancelAsyncOperationsOnNonFatalErrors;
 
+  /// Controls whether the work core does internally while opening the `Realm` with [Realm.open], such as
+  /// bootstrapping subscriptions, runs on a native event loop instead of the current isolate.
+  ///
+  /// This saves waking the isolate for work that has no user visible effect, which adds up in server processes
+  /// opening many realms per isolate. Only [Realm.open] is affected. Progress notifications, the returned `Realm`,
+  /// and everything done with it afterwards, such as async commits and sync progress, still run on the current
+  /// isolate. Only supported on the Dart VM.
+  final bool openOnNativeEventLoop;
+
   FlexibleSyncConfiguration._(
     this.user,
     super.schemaObjects, {
@@ -374,6 +385,7 @@ class FlexibleSyncConfiguration extends Configuration {
     this.shouldCompactCallback,
     this.schemaVersion = 0,
     this.cancelAsyncOperationsOnNonFatalErrors = false,
+    this.openOnNativeEventLoop = false,
   }) : super._();
 
   @override
@@ -499,11 +511,55 @@ abstract class ClientResetHandler {
   /// The callback that handles the [ClientResetError].
   final ClientResetCallback? onManualReset;
 
+  /// How long the sync client waits for a before or after reset callback to complete.
+  ///
+  /// The callbacks are not non-blocking. The sync client can't proceed with the client reset until the
+  /// callback completes, so a sync thread is blocked while the isolate that opened the realm gets around
+  /// to running the callback, and while the callback runs, including any time it spends awaiting.
+  /// If the callback hasn't completed in time, the automatic client reset fails and falls back to
+  /// [onManualReset]. A callback that has started keeps running on the isolate, but its outcome is ignored.
+  /// If `null`, the sync thread waits indefinitely.
+  final Duration? callbackTimeout;
+
   const ClientResetHandler._(this._mode, this.onManualReset,
-      {BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterDiscard, AfterResetCallback? onAfterRecovery})
+      {BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterDiscard, AfterResetCallback? onAfterRecovery, this.callbackTimeout})
       : _onBeforeReset = onBeforeReset,
         _onAfterDiscard = onAfterDiscard,
         _onAfterRecovery = onAfterRecovery;
+
+  /// Counters for the before and after reset callbacks of all client resets in the process.
+  static ClientResetMetrics get metrics => realmCore.clientResetMetrics;
+}
+
+/// Counters for the before and after reset callbacks of client resets, see [ClientResetHandler.metrics].
+/// {@category Sync}
+class ClientResetMetrics {
+  /// The number of callbacks invoked.
+  final int count;
+
+  /// The number of callbacks that did not complete within [ClientResetHandler.callbackTimeout].
+  final int timeoutCount;
+
+  /// The number of callbacks abandoned before they completed, because the session was torn down.
+  final int cancelledCount;
+
+  /// The time the sync client spent waiting for callbacks in total.
+  final Duration totalWait;
+
+  /// The longest time the sync client spent waiting for a single callback.
+  final Duration maxWait;
+
+  /// The number of callbacks the sync client is currently waiting for.
+  final int inFlight;
+
+  const ClientResetMetrics({
+    required this.count,
+    required this.timeoutCount,
+    required this.cancelledCount,
+    required this.totalWait,
+    required this.maxWait,
+    required this.inFlight,
+  });
 }
 
 /// A client reset strategy where the user needs to fully take care of a client reset.
@@ -538,8 +594,10 @@ class DiscardUnsyncedChangesHandler extends ClientResetHandler {
   /// The first two are invoked just before and after the client reset has happened,
   /// while the last one will be invoked in case an error occurs during the automated process and the system needs to fallback to a manual mode.
   /// The freshly downloaded copy of the synchronized Realm triggers all change notifications as a write transaction is internally simulated.
-  const DiscardUnsyncedChangesHandler({BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterReset, ClientResetCallback? onManualResetFallback})
-      : super._(ClientResyncModeInternal.discardLocal, onManualResetFallback, onAfterDiscard: onAfterReset, onBeforeReset: onBeforeReset);
+  const DiscardUnsyncedChangesHandler(
+      {BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterReset, ClientResetCallback? onManualResetFallback, Duration? callbackTimeout})
+      : super._(ClientResyncModeInternal.discardLocal, onManualResetFallback,
+            onAfterDiscard: onAfterReset, onBeforeReset: onBeforeReset, callbackTimeout: callbackTimeout);
 }
 
 /// A client reset strategy that attempts to automatically recover any unsynchronized changes.
@@ -560,8 +618,10 @@ class RecoverUnsyncedChangesHandler extends ClientResetHandler {
   /// This strategy supplies three callbacks: [onBeforeReset], [onAfterReset] and [onManualResetFallback].
   /// The first two are invoked just before and after the client reset has happened, while the last one is invoked
   /// in case an error occurs during the automated process and the system needs to fallback to a manual mode.
-  const RecoverUnsyncedChangesHandler({BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterReset, ClientResetCallback? onManualResetFallback})
-      : super._(ClientResyncModeInternal.recover, onManualResetFallback, onBeforeReset: onBeforeReset, onAfterRecovery: onAfterReset);
+  const RecoverUnsyncedChangesHandler(
+      {BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterReset, ClientResetCallback? onManualResetFallback, Duration? callbackTimeout})
+      : super._(ClientResyncModeInternal.recover, onManualResetFallback,
+            onBeforeReset: onBeforeReset, onAfterRecovery: onAfterReset, callbackTimeout: callbackTimeout);
 }
 
 /// A client reset strategy that attempts to automatically recover any unsynchronized changes.
@@ -598,9 +658,13 @@ class RecoverOrDiscardUnsyncedChangesHandler extends ClientResetHandler {
   /// The callback is never called if the discard unsynced client reset fails.
   /// [onManualResetFallback] is invoked whenever an error occurs in either of the recovery stragegies and the system needs to fallback to a manual mode.
   const RecoverOrDiscardUnsyncedChangesHandler(
-      {BeforeResetCallback? onBeforeReset, AfterResetCallback? onAfterRecovery, AfterResetCallback? onAfterDiscard, ClientResetCallback? onManualResetFallback})
+      {BeforeResetCallback? onBeforeReset,
+      AfterResetCallback? onAfterRecovery,
+      AfterResetCallback? onAfterDiscard,
+      ClientResetCallback? onManualResetFallback,
+      Duration? callbackTimeout})
       : super._(ClientResyncModeInternal.recoverOrDiscard, onManualResetFallback,
-            onBeforeReset: onBeforeReset, onAfterDiscard: onAfterDiscard, onAfterRecovery: onAfterRecovery);
+            onBeforeReset: onBeforeReset, onAfterDiscard: onAfterDiscard, onAfterRecovery: onAfterRecovery, callbackTimeout: callbackTimeout);
 }
 
 /// @nodoc
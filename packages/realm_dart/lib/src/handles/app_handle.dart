@@ -36,4 +36,6 @@ abstract interface class AppHandle {
   Future<void> deleteUser(UserHandle user);
   bool resetRealm(String realmPath);
   Future<String> callAppFunction(UserHandle user, String functionName, String? argsAsJSON);
+
+  List<HttpEndpointMetrics> get httpTransportMetrics;
 }
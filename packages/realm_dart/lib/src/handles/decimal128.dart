@@ -1,6 +1,8 @@
 // Copyright 2024 MongoDB, Inc.
 // SPDX-License-Identifier: Apache-2.0
 
+import 'dart:typed_data';
+
 import 'package:realm_common/realm_common.dart' as common;
 
 import 'native/decimal128.dart'
@@ -37,6 +39,11 @@ abstract interface class Decimal128 implements Comparable<Decimal128>, common.De
   /// Converts a `double` into a [Decimal128].
   factory Decimal128.fromDouble(double value) = impl.Decimal128.fromDouble;
 
+  /// Formats all [values] at once, returning the same strings as [toString].
+  ///
+  /// This is much faster than calling [toString] on each value, when formatting many values.
+  static List<String> formatAll(Iterable<Decimal128> values) => impl.Decimal128.formatAll(values.cast<impl.Decimal128>());
+
   /// Returns `true` if `this` is NaN.
   bool get isNaN;
 
@@ -77,3 +84,49 @@ abstract interface class Decimal128 implements Comparable<Decimal128>, common.De
   @override
   int compareTo(Decimal128 other);
 } 
+
+/// The element-wise operations supported by [Decimal128List.combine].
+enum Decimal128Operation {
+  add,
+  subtract,
+  multiply,
+  divide,
+}
+
+/// A fixed-length list of [Decimal128] values stored contiguously in native memory.
+///
+/// Arithmetic, reductions, comparisons and sorting run over the whole list with a single
+/// native call, which is much faster than operating on the elements one by one.
+abstract interface class Decimal128List implements List<Decimal128> {
+  /// Creates a list of [length] zeros.
+  factory Decimal128List(int length) = impl.Decimal128List;
+
+  /// Creates a list containing all [values].
+  factory Decimal128List.fromList(Iterable<Decimal128> values) = impl.Decimal128List.fromList;
+
+  /// Returns a new list with `this[i] operation other[i]` for every index.
+  ///
+  /// Throws an [ArgumentError] if [other] does not have the same length as `this`.
+  Decimal128List combine(Decimal128List other, Decimal128Operation operation);
+
+  /// The sum of all elements, or zero if the list is empty.
+  Decimal128 sum();
+
+  /// The smallest element, ignoring NaNs unless all elements are NaN. NaN if the list is empty.
+  Decimal128 min();
+
+  /// The largest element, ignoring NaNs unless all elements are NaN. NaN if the list is empty.
+  Decimal128 max();
+
+  /// The average of all elements, or NaN if the list is empty.
+  Decimal128 average();
+
+  /// Returns `this[i].compareTo(other[i])` for every index.
+  ///
+  /// Throws an [ArgumentError] if [other] does not have the same length as `this`.
+  Int32List compareEach(Decimal128List other);
+
+  /// Sorts the list in place. Without [compare], the sort happens natively in the order of [Decimal128.compareTo].
+  @override
+  void sort([int Function(Decimal128 a, Decimal128 b)? compare]);
+}
@@ -3,6 +3,7 @@
 
 abstract class HandleBase {
   bool get released;
+  bool get releasedByScope;
   bool get isUnowned;
   void releaseCore();
   void release();
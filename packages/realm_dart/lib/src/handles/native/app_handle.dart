@@ -24,7 +24,7 @@ import 'user_handle.dart';
 import '../app_handle.dart' as intf;
 
 class AppHandle extends HandleBase<realm_app> implements intf.AppHandle {
-  AppHandle(Pointer<realm_app> pointer) : super(pointer, 16);
+  AppHandle(Pointer<realm_app> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_APP);
 
   static bool _firstTime = true;
   factory AppHandle.from(AppConfiguration configuration) {
@@ -36,7 +36,10 @@ class AppHandle extends HandleBase<realm_app> implements intf.AppHandle {
     }
     Directory(configuration.baseFilePath).createSync(recursive: true);
 
-    final httpTransportHandle = HttpTransportHandle.from(configuration.httpClient);
+    final httpMetrics = using((arena) => realmLib.realm_dart_http_metrics_get(configuration.appId.toCharPtr(arena)));
+    final httpTransportHandle = configuration.useNativeHttpTransport
+        ? HttpTransportHandle.native(httpMetrics)
+        : HttpTransportHandle.from(configuration.httpClient, httpMetrics);
     final appConfigHandle = _createAppConfig(configuration, httpTransportHandle);
     return AppHandle(realmLib.realm_app_create_cached(appConfigHandle.pointer));
   }
@@ -344,6 +347,47 @@ class AppHandle extends HandleBase<realm_app> implements intf.AppHandle {
       return completer.future;
     });
   }
+
+  @override
+  List<HttpEndpointMetrics> get httpTransportMetrics {
+    return using((arena) {
+      final metrics = realmLib.realm_dart_http_metrics_get(id.toCharPtr(arena));
+      // the number of endpoints only grows, so ask for a few more than currently known
+      final capacity = realmLib.realm_dart_http_metrics_get_endpoints(metrics, nullptr, 0) + 4;
+      final endpoints = arena<realm_dart_http_endpoint_metrics_t>(capacity);
+      final count = realmLib.realm_dart_http_metrics_get_endpoints(metrics, endpoints, capacity);
+      final result = <HttpEndpointMetrics>[];
+      for (var i = 0; i < count && i < capacity; i++) {
+        result.add((endpoints + i).ref.toDart());
+      }
+      return result;
+    });
+  }
+}
+
+extension on realm_dart_http_endpoint_metrics_t {
+  HttpEndpointMetrics toDart() {
+    return (
+      method: HttpMethod.values[method],
+      path: path.cast<Utf8>().toDartString(),
+      requestCount: request_count,
+      inFlight: in_flight,
+      timeoutCount: timeout_count,
+      socketErrorCount: socket_error_count,
+      errorCount: error_count,
+      bytesSent: bytes_sent,
+      bytesReceived: bytes_received,
+      queueP50: Duration(microseconds: queue_p50_us),
+      queueP99: Duration(microseconds: queue_p99_us),
+      queueMax: Duration(microseconds: queue_max_us),
+      firstByteP50: Duration(microseconds: first_byte_p50_us),
+      firstByteP99: Duration(microseconds: first_byte_p99_us),
+      firstByteMax: Duration(microseconds: first_byte_max_us),
+      latencyP50: Duration(microseconds: latency_p50_us),
+      latencyP99: Duration(microseconds: latency_p99_us),
+      latencyMax: Duration(microseconds: latency_max_us),
+    );
+  }
 }
 
 Pointer<Void> createAsyncFunctionCallbackUserdata(Completer<String> completer) {
@@ -357,7 +401,7 @@ Pointer<Void> createAsyncFunctionCallbackUserdata(Completer<String> completer) {
   final userdata = realmLib.realm_dart_userdata_async_new(
     completer,
     callback.cast(),
-    schedulerHandle.pointer,
+    schedulerHandle.callbacksPointer,
   );
 
   return userdata.cast();
@@ -385,7 +429,7 @@ Pointer<Void> createAsyncCallbackUserdata(Completer<void> completer) {
   final userdata = realmLib.realm_dart_userdata_async_new(
     completer,
     callback.cast(),
-    schedulerHandle.pointer,
+    schedulerHandle.callbacksPointer,
   );
 
   return userdata.cast();
@@ -403,7 +447,7 @@ void _voidCompletionCallback(Pointer<Void> userdata, Pointer<realm_app_error> er
 }
 
 class _AppConfigHandle extends HandleBase<realm_app_config> {
-  _AppConfigHandle(Pointer<realm_app_config> pointer) : super(pointer, 8);
+  _AppConfigHandle(Pointer<realm_app_config> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CONFIG);
 }
 
 _AppConfigHandle _createAppConfig(AppConfiguration configuration, HttpTransportHandle httpTransport) {
@@ -16,10 +16,15 @@ import 'session_handle.dart';
 import '../async_open_task_handle.dart' as intf;
 
 class AsyncOpenTaskHandle extends HandleBase<realm_async_open_task_t> implements intf.AsyncOpenTaskHandle {
-  AsyncOpenTaskHandle(Pointer<realm_async_open_task_t> pointer) : super(pointer, 32);
+  AsyncOpenTaskHandle(Pointer<realm_async_open_task_t> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_ASYNC_OPEN_TASK);
 
   factory AsyncOpenTaskHandle.from(FlexibleSyncConfiguration config) {
     final configHandle = ConfigHandle.from(config);
+    if (config.openOnNativeEventLoop) {
+      // The realm is handed over as a thread safe reference, and bound to the isolate scheduler
+      // in _openRealmAsyncCallback, so the task itself never needs to wake the isolate.
+      realmLib.realm_config_set_scheduler(configHandle.pointer, schedulerHandle.eventLoopPointer);
+    }
     final asyncOpenTaskPtr = realmLib.realm_open_synchronized(configHandle.pointer).raiseLastErrorIfNull();
     return AsyncOpenTaskHandle(asyncOpenTaskPtr);
   }
@@ -30,7 +35,7 @@ class AsyncOpenTaskHandle extends HandleBase<realm_async_open_task_t> implements
     if (!completer.isCancelled) {
       final callback =
           Pointer.fromFunction<Void Function(Handle, Pointer<realm_thread_safe_reference> realm, Pointer<realm_async_error_t> error)>(_openRealmAsyncCallback);
-      final userData = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.pointer);
+      final userData = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.callbacksPointer);
       realmLib.realm_async_open_task_start(
         pointer,
         realmLib.addresses.realm_dart_async_open_task_callback,
@@ -51,13 +56,13 @@ class AsyncOpenTaskHandle extends HandleBase<realm_async_open_task_t> implements
     RealmAsyncOpenProgressNotificationsController controller,
   ) {
     final callback = Pointer.fromFunction<Void Function(Handle, Uint64, Uint64, Double)>(syncProgressCallback);
-    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.pointer);
+    final userdata = realmLib.realm_dart_sync_progress_userdata_new(controller, callback.cast(), schedulerHandle.callbacksPointer, 0);
     return AsyncOpenTaskProgressNotificationTokenHandle(
       realmLib.realm_async_open_task_register_download_progress_notifier(
         pointer,
         realmLib.addresses.realm_dart_sync_progress_callback,
         userdata.cast(),
-        realmLib.addresses.realm_dart_userdata_async_free,
+        realmLib.addresses.realm_dart_sync_progress_userdata_free,
       ),
     );
   }
@@ -65,7 +70,8 @@ class AsyncOpenTaskHandle extends HandleBase<realm_async_open_task_t> implements
 
 class AsyncOpenTaskProgressNotificationTokenHandle extends HandleBase<realm_async_open_task_progress_notification_token_t>
     implements intf.AsyncOpenTaskProgressNotificationTokenHandle {
-  AsyncOpenTaskProgressNotificationTokenHandle(Pointer<realm_async_open_task_progress_notification_token_t> pointer) : super(pointer, 40);
+  AsyncOpenTaskProgressNotificationTokenHandle(Pointer<realm_async_open_task_progress_notification_token_t> pointer)
+      : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN);
 }
 
 void _openRealmAsyncCallback(Object userData, Pointer<realm_thread_safe_reference> realmSafePtr, Pointer<realm_async_error_t> error) {
@@ -14,7 +14,7 @@ import 'realm_library.dart';
 import '../collection_changes_handle.dart' as intf;
 
 class CollectionChangesHandle extends HandleBase<realm_collection_changes> implements intf.CollectionChangesHandle {
-  CollectionChangesHandle(Pointer<realm_collection_changes> pointer) : super(pointer, 256);
+  CollectionChangesHandle(Pointer<realm_collection_changes> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CHANGES);
 
   @override
   CollectionChanges get changes {
@@ -3,6 +3,7 @@
 
 import 'dart:async';
 import 'dart:ffi';
+import 'dart:math' as math;
 
 import '../../configuration.dart';
 import '../../migration.dart';
@@ -20,7 +21,7 @@ import 'schema_handle.dart';
 import 'user_handle.dart';
 
 class ConfigHandle extends HandleBase<realm_config> {
-  ConfigHandle(Pointer<realm_config> pointer) : super(pointer, 512);
+  ConfigHandle(Pointer<realm_config> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CONFIG);
 
   factory ConfigHandle.from(Configuration config) {
     return using((arena) {
@@ -95,26 +96,31 @@ class ConfigHandle extends HandleBase<realm_config> {
 
           final errorHandlerCallback =
               Pointer.fromFunction<Void Function(Handle, Pointer<realm_sync_session_t>, realm_sync_error_t)>(_syncErrorHandlerCallback);
-          final errorHandlerUserdata = realmLib.realm_dart_userdata_async_new(config, errorHandlerCallback.cast(), schedulerHandle.pointer);
+          final errorHandlerUserdata = realmLib.realm_dart_userdata_async_new(config, errorHandlerCallback.cast(), schedulerHandle.callbacksPointer);
           realmLib.realm_sync_config_set_error_handler(syncConfigPtr, realmLib.addresses.realm_dart_sync_error_handler_callback, errorHandlerUserdata.cast(),
               realmLib.addresses.realm_dart_userdata_async_free);
 
+          // zero waits indefinitely
+          final callbackTimeout = config.clientResetHandler.callbackTimeout;
+          final callbackTimeoutMs = callbackTimeout == null ? 0 : math.max(callbackTimeout.inMilliseconds, 1);
           if (config.clientResetHandler.onBeforeReset != null) {
             final syncBeforeResetCallback = Pointer.fromFunction<Void Function(Handle, Pointer<shared_realm>, Pointer<Void>)>(_syncBeforeResetCallback);
-            final beforeResetUserdata = realmLib.realm_dart_userdata_async_new(config, syncBeforeResetCallback.cast(), schedulerHandle.pointer);
+            final beforeResetUserdata = realmLib.realm_dart_client_reset_userdata_new(
+                config, syncBeforeResetCallback.cast(), schedulerHandle.callbacksPointer, callbackTimeoutMs);
 
             realmLib.realm_sync_config_set_before_client_reset_handler(syncConfigPtr, realmLib.addresses.realm_dart_sync_before_reset_handler_callback,
-                beforeResetUserdata.cast(), realmLib.addresses.realm_dart_userdata_async_free);
+                beforeResetUserdata.cast(), realmLib.addresses.realm_dart_client_reset_userdata_free);
           }
 
           if (config.clientResetHandler.onAfterRecovery != null || config.clientResetHandler.onAfterDiscard != null) {
             final syncAfterResetCallback =
                 Pointer.fromFunction<Void Function(Handle, Pointer<shared_realm>, Pointer<realm_thread_safe_reference>, Bool, Pointer<Void>)>(
                     _syncAfterResetCallback);
-            final afterResetUserdata = realmLib.realm_dart_userdata_async_new(config, syncAfterResetCallback.cast(), schedulerHandle.pointer);
+            final afterResetUserdata = realmLib.realm_dart_client_reset_userdata_new(
+                config, syncAfterResetCallback.cast(), schedulerHandle.callbacksPointer, callbackTimeoutMs);
 
             realmLib.realm_sync_config_set_after_client_reset_handler(syncConfigPtr, realmLib.addresses.realm_dart_sync_after_reset_handler_callback,
-                afterResetUserdata.cast(), realmLib.addresses.realm_dart_userdata_async_free);
+                afterResetUserdata.cast(), realmLib.addresses.realm_dart_client_reset_userdata_free);
           }
 
           if (config.shouldCompactCallback != null) {
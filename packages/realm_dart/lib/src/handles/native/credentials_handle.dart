@@ -14,7 +14,7 @@ import 'to_native.dart';
 import '../credentials_handle.dart' as intf;
 
 class CredentialsHandle extends HandleBase<realm_app_credentials> implements intf.CredentialsHandle {
-  CredentialsHandle(Pointer<realm_app_credentials> pointer) : super(pointer, 16);
+  CredentialsHandle(Pointer<realm_app_credentials> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CREDENTIALS);
 
   factory CredentialsHandle.anonymous(bool reuseCredentials) {
     return CredentialsHandle(realmLib.realm_app_credentials_new_anonymous(reuseCredentials));
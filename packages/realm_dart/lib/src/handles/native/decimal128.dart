@@ -1,8 +1,11 @@
 // Copyright 2023 MongoDB, Inc.
 // SPDX-License-Identifier: Apache-2.0
 
+import 'dart:collection';
 import 'dart:convert';
 import 'dart:ffi';
+import 'dart:math' as math;
+import 'dart:typed_data';
 
 import 'ffi.dart';
 import 'realm_bindings.dart';
@@ -12,6 +15,10 @@ import 'to_native.dart';
 import '../decimal128.dart' as intf;
 
 /// A 128-bit decimal floating point number.
+///
+/// The value is kept as its IEEE 754-2008 BID encoding. Operations on finite values
+/// with coefficients below 2^63 and a common exponent, which covers decimals built
+/// from ints, are done in Dart. Everything else is left to the native Intel library.
 class Decimal128 implements intf.Decimal128 {
   /// The value 0.
   static final zero = Decimal128.fromInt(0);
@@ -23,7 +30,7 @@ class Decimal128 implements intf.Decimal128 {
   static final ten = Decimal128.fromInt(10);
 
   /// The value NaN.
-  static final nan = Decimal128._(realmLib.realm_dart_decimal128_nan());
+  static final nan = Decimal128._fromNative(realmLib.realm_dart_decimal128_nan());
 
   /// The value +Inf.
   static final infinity = one / zero; // +Inf
@@ -31,9 +38,46 @@ class Decimal128 implements intf.Decimal128 {
   /// The value -Inf.
   static final negativeInfinity = -infinity;
 
-  final realm_decimal128_t _value;
+  static const _signBit = 1 << 63;
+  static const _specialBits = 3 << 61; // both set for NaN, Inf and non-canonical large coefficients
+  static const _nanBits = 0x1f << 58;
+  static const _exponentShift = 49;
+  static const _exponentMask = 0x3fff;
+  static const _exponentBias = 6176;
+  static const _maxExponent = 12287;
+  static const _coefficientHighMask = (1 << _exponentShift) - 1;
 
-  Decimal128._(this._value);
+  // The low and high 64 bits of the encoding. Dart ints are signed, so _high is negative for negative values.
+  final int _low;
+  final int _high;
+
+  const Decimal128._(this._low, this._high);
+
+  Decimal128._fromNative(realm_decimal128_t value) : this._(value.w[0], value.w[1]);
+
+  Decimal128._small(int coefficient, int exponent, bool negative) : this._(coefficient, (negative ? _signBit : 0) | (exponent << _exponentShift));
+
+  // Scratch buffers for toString and for passing values to native. Statics are per isolate, so they are never shared between isolates.
+  static final _stringBuffer = malloc<Char>(RLM_DART_DECIMAL128_STRING_BUFFER_SIZE);
+  static final _nativeBuffer = malloc<realm_decimal128_t>(2);
+
+  realm_decimal128_t _toNative([int slot = 0]) {
+    final value = _nativeBuffer[slot];
+    value.w[0] = _low;
+    value.w[1] = _high;
+    return value;
+  }
+
+  /// Whether the value is finite with a coefficient below 2^63, so it can be handled in Dart.
+  bool get _isSmall => (_high & _specialBits) != _specialBits && (_high & _coefficientHighMask) == 0 && _low >= 0;
+
+  int get _exponent => (_high >> _exponentShift) & _exponentMask;
+
+  bool get _isNegative => _high < 0;
+
+  int get _signedCoefficient => _isNegative ? -_low : _low;
+
+  bool _isSmallWithSameExponent(Decimal128 other) => _isSmall && other._isSmall && _exponent == other._exponent;
 
   static final _validInput = RegExp(r'^[+-]?((\d+\.?\d*|\d*\.?\d+)([eE][+-]?\d+)?|NaN|Inf(inity)?)$');
 
@@ -42,7 +86,7 @@ class Decimal128 implements intf.Decimal128 {
     if (!_validInput.hasMatch(source)) return null;
     return using((arena) {
       final result = realmLib.realm_dart_decimal128_from_string(source.toCharPtr(arena));
-      return Decimal128._(result);
+      return Decimal128._fromNative(result);
     });
   }
 
@@ -53,7 +97,11 @@ class Decimal128 implements intf.Decimal128 {
 
   /// Converts a `int` into a [Decimal128].
   factory Decimal128.fromInt(int value) {
-    return Decimal128._(realmLib.realm_dart_decimal128_from_int64(value));
+    if (value == _signBit) {
+      // -2^63 has no positive counterpart in an int
+      return Decimal128._fromNative(realmLib.realm_dart_decimal128_from_int64(value));
+    }
+    return Decimal128._small(value.abs(), _exponentBias, value < 0);
   }
 
   /// Converts a `double` into a [Decimal128].
@@ -63,35 +111,52 @@ class Decimal128 implements intf.Decimal128 {
 
   /// Returns `true` if `this` is NaN.
   @override
-  bool get isNaN => realmLib.realm_dart_decimal128_is_nan(_value);
+  bool get isNaN => (_high & _nanBits) == _nanBits;
 
   /// Adds `this` with `other` and returns a new [Decimal128].
   @override
   Decimal128 operator +(covariant Decimal128 other) {
-    return Decimal128._(realmLib.realm_dart_decimal128_add(_value, other._value));
+    return _addSmall(other, false) ?? Decimal128._fromNative(realmLib.realm_dart_decimal128_add(_toNative(0), other._toNative(1)));
   }
 
   /// Subtracts `other` from `this` and returns a new [Decimal128].
   @override
   Decimal128 operator -(covariant Decimal128 other) {
-    return Decimal128._(realmLib.realm_dart_decimal128_subtract(_value, other._value));
+    return _addSmall(other, true) ?? Decimal128._fromNative(realmLib.realm_dart_decimal128_subtract(_toNative(0), other._toNative(1)));
+  }
+
+  Decimal128? _addSmall(Decimal128 other, bool subtract) {
+    if (!_isSmallWithSameExponent(other)) return null;
+    final x = _signedCoefficient;
+    final y = subtract ? -other._signedCoefficient : other._signedCoefficient;
+    final sum = x + y;
+    if (((x ^ sum) & (y ^ sum)) < 0 || sum == _signBit) return null; // overflow
+    // An exact zero is only negative when both operands are negative zeros
+    final negative = sum == 0 ? _isNegative && (other._isNegative != subtract) : sum < 0;
+    return Decimal128._small(sum.abs(), _exponent, negative);
   }
 
   /// Multiplies `this` with `other` and returns a new [Decimal128].
   @override
   Decimal128 operator *(covariant Decimal128 other) {
-    return Decimal128._(realmLib.realm_dart_decimal128_multiply(_value, other._value));
+    if (_isSmall && other._isSmall && _low.bitLength + other._low.bitLength < 64) {
+      final exponent = _exponent + other._exponent - _exponentBias;
+      if (exponent >= 0 && exponent <= _maxExponent) {
+        return Decimal128._small(_low * other._low, exponent, _isNegative != other._isNegative);
+      }
+    }
+    return Decimal128._fromNative(realmLib.realm_dart_decimal128_multiply(_toNative(0), other._toNative(1)));
   }
 
   /// Divides `this` by `other` and returns a new [Decimal128].
   @override
   Decimal128 operator /(covariant Decimal128 other) {
-    return Decimal128._(realmLib.realm_dart_decimal128_divide(_value, other._value));
+    return Decimal128._fromNative(realmLib.realm_dart_decimal128_divide(_toNative(0), other._toNative(1)));
   }
 
   /// Negates `this` and returns a new [Decimal128].
   @override
-  Decimal128 operator -() => Decimal128._(realmLib.realm_dart_decimal128_negate(_value));
+  Decimal128 operator -() => Decimal128._(_low, _high ^ _signBit);
 
   /// Returns the absolute value of `this`.
   @override
@@ -104,7 +169,8 @@ class Decimal128 implements intf.Decimal128 {
     // WARNING: Don't use identical to ensure nan != nan,
     // if (identical(this, other)) return true;
     if (other is Decimal128) {
-      return realmLib.realm_dart_decimal128_equal(_value, other._value);
+      if (_isSmallWithSameExponent(other)) return _signedCoefficient == other._signedCoefficient;
+      return realmLib.realm_dart_decimal128_equal(_toNative(0), other._toNative(1));
     }
     return false;
   }
@@ -112,7 +178,8 @@ class Decimal128 implements intf.Decimal128 {
   /// Returns `true` if `this` is less than `other`.
   @override
   bool operator <(covariant Decimal128 other) {
-    return realmLib.realm_dart_decimal128_less_than(_value, other._value);
+    if (_isSmallWithSameExponent(other)) return _signedCoefficient < other._signedCoefficient;
+    return realmLib.realm_dart_decimal128_less_than(_toNative(0), other._toNative(1));
   }
 
   /// Returns `true` if `this` is less than or equal to `other`.
@@ -122,7 +189,8 @@ class Decimal128 implements intf.Decimal128 {
   /// Returns `true` if `this` is greater than `other`.
   @override
   bool operator >(covariant Decimal128 other) {
-    return realmLib.realm_dart_decimal128_greater_than(_value, other._value);
+    if (_isSmallWithSameExponent(other)) return _signedCoefficient > other._signedCoefficient;
+    return realmLib.realm_dart_decimal128_greater_than(_toNative(0), other._toNative(1));
   }
 
   /// Returns `true` if `this` is greater than or equal to `other`.
@@ -131,24 +199,170 @@ class Decimal128 implements intf.Decimal128 {
 
   /// Converts `this` to an `int`. Possibly loosing precision.
   @override
-  int toInt() => realmLib.realm_dart_decimal128_to_int64(_value);
+  int toInt() {
+    if (_isSmall && _exponent == _exponentBias) return _signedCoefficient;
+    return realmLib.realm_dart_decimal128_to_int64(_toNative());
+  }
 
   /// String representation of `this`.
   @override
   String toString() {
+    final length = realmLib.realm_dart_decimal128_to_string_buffer(_toNative(), _stringBuffer);
+    return ascii.decode(_stringBuffer.cast<Uint8>().asTypedList(length));
+  }
+
+  /// Formats all [values] with a single native call, returning the same strings as [toString].
+  static List<String> formatAll(Iterable<Decimal128> values) {
+    final list = values.toList(growable: false);
+    if (list.isEmpty) return [];
     return using((arena) {
-      final realmString = realmLib.realm_dart_decimal128_to_string(_value);
-      return ascii.decode(realmString.data.cast<Uint8>().asTypedList(realmString.size));
+      final count = list.length;
+      final nativeValues = arena<realm_decimal128_t>(count);
+      for (var i = 0; i < count; i++) {
+        final value = list[i];
+        nativeValues[i].w[0] = value._low;
+        nativeValues[i].w[1] = value._high;
+      }
+      // the terminating zeros are not written
+      final bufferSize = count * (RLM_DART_DECIMAL128_STRING_BUFFER_SIZE - 1);
+      final buffer = arena<Char>(bufferSize);
+      final ends = arena<Uint32>(count);
+      final formatted = realmLib.realm_dart_decimal128_to_string_batch(nativeValues, count, buffer, bufferSize, ends);
+      assert(formatted == count);
+
+      final bytes = buffer.cast<Uint8>().asTypedList(bufferSize);
+      final endList = ends.asTypedList(count);
+      var start = 0;
+      return List.generate(count, (i) {
+        final end = endList[i];
+        final string = ascii.decoder.convert(bytes, start, end);
+        start = end;
+        return string;
+      }, growable: false);
     });
   }
 
   /// Compares `this` to `other`.
   @override
-  int compareTo(covariant Decimal128 other) => realmLib.realm_dart_decimal128_compare_to(_value, other._value);
+  int compareTo(covariant Decimal128 other) {
+    if (_isSmallWithSameExponent(other)) {
+      // total order, so -0 comes before +0
+      if (_isNegative != other._isNegative) return _isNegative ? -1 : 1;
+      final order = _low.compareTo(other._low);
+      return _isNegative ? -order : order;
+    }
+    return realmLib.realm_dart_decimal128_compare_to(_toNative(0), other._toNative(1));
+  }
 }
 
 extension Decimal128Internal on Decimal128 {
-  realm_decimal128_t get value => _value;
+  /// Copies the encoding of `this` into [target], which is typically a field of a native struct.
+  void copyTo(realm_decimal128_t target) {
+    target.w[0] = _low;
+    target.w[1] = _high;
+  }
+
+  /// The low and high 64 bits of the encoding.
+  (int, int) get bits => (_low, _high);
+
+  /// Reads [value] right away, so it is safe to pass a view into native memory.
+  static Decimal128 fromNative(realm_decimal128_t value) => Decimal128._fromNative(value);
+}
+
+/// A fixed-length list of [Decimal128] values stored contiguously in native memory.
+class Decimal128List with ListMixin<intf.Decimal128> implements intf.Decimal128List {
+  static final _finalizer = Finalizer<Pointer<realm_decimal128_t>>(malloc.free);
 
-  static Decimal128 fromNative(realm_decimal128_t value) => Decimal128._(value);
+  final Pointer<realm_decimal128_t> _values;
+
+  @override
+  final int length;
+
+  Decimal128List._(this.length) : _values = malloc<realm_decimal128_t>(math.max(length, 1)) {
+    _finalizer.attach(this, _values);
+  }
+
+  /// Creates a list of [length] zeros.
+  factory Decimal128List(int length) {
+    RangeError.checkNotNegative(length, 'length');
+    final list = Decimal128List._(length);
+    list.fillRange(0, length, Decimal128.zero);
+    return list;
+  }
+
+  /// Creates a list containing all [values].
+  factory Decimal128List.fromList(Iterable<intf.Decimal128> values) {
+    if (values is Decimal128List) {
+      final list = Decimal128List._(values.length);
+      for (var i = 0; i < values.length; i++) {
+        final from = values._values[i], to = list._values[i];
+        to.w[0] = from.w[0];
+        to.w[1] = from.w[1];
+      }
+      return list;
+    }
+    final source = values.toList(growable: false);
+    final list = Decimal128List._(source.length);
+    list.setAll(0, source);
+    return list;
+  }
+
+  @override
+  set length(int newLength) => throw UnsupportedError('Cannot change the length of a fixed-length list');
+
+  @override
+  Decimal128 operator [](int index) {
+    RangeError.checkValidIndex(index, this);
+    return Decimal128._fromNative(_values[index]);
+  }
+
+  @override
+  void operator []=(int index, covariant Decimal128 value) {
+    RangeError.checkValidIndex(index, this);
+    value.copyTo(_values[index]);
+  }
+
+  @override
+  Decimal128List combine(covariant Decimal128List other, intf.Decimal128Operation operation) {
+    _checkSameLength(other);
+    final result = Decimal128List._(length);
+    realmLib.realm_dart_decimal128_batch_binary(operation.index, _values, other._values, result._values, length);
+    return result;
+  }
+
+  @override
+  Decimal128 sum() => _reduce(realm_dart_decimal128_reduction.RLM_DART_DECIMAL128_REDUCTION_SUM);
+
+  @override
+  Decimal128 min() => _reduce(realm_dart_decimal128_reduction.RLM_DART_DECIMAL128_REDUCTION_MIN);
+
+  @override
+  Decimal128 max() => _reduce(realm_dart_decimal128_reduction.RLM_DART_DECIMAL128_REDUCTION_MAX);
+
+  @override
+  Decimal128 average() => _reduce(realm_dart_decimal128_reduction.RLM_DART_DECIMAL128_REDUCTION_AVERAGE);
+
+  Decimal128 _reduce(int reduction) => Decimal128._fromNative(realmLib.realm_dart_decimal128_batch_reduce(reduction, _values, length, nullptr));
+
+  @override
+  Int32List compareEach(covariant Decimal128List other) {
+    _checkSameLength(other);
+    return using((arena) {
+      final out = arena<Int32>(math.max(length, 1));
+      realmLib.realm_dart_decimal128_batch_compare(_values, other._values, out, length);
+      return Int32List.fromList(out.asTypedList(length));
+    });
+  }
+
+  @override
+  void sort([int Function(intf.Decimal128 a, intf.Decimal128 b)? compare]) {
+    if (compare != null) return super.sort(compare);
+    realmLib.realm_dart_decimal128_batch_sort(_values, length);
+  }
+
+  void _checkSameLength(Decimal128List other) {
+    if (other.length != length) {
+      throw ArgumentError.value(other, 'other', 'Expected a list of length $length, but got ${other.length}');
+    }
+  }
 }
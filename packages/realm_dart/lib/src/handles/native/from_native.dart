@@ -52,9 +52,8 @@ extension RealmValueEx on realm_value_t {
         final nanoseconds = values.timestamp.nanoseconds;
         return DateTime.fromMicrosecondsSinceEpoch(seconds * _microsecondsPerSecond + nanoseconds ~/ _nanosecondsPerMicrosecond, isUtc: true);
       case realm_value_type.RLM_TYPE_DECIMAL128:
-        var decimal = values.decimal128; // NOTE: Does not copy the struct!
-        decimal = realmLib.realm_dart_decimal128_copy(decimal); // This is a workaround to that
-        return Decimal128Internal.fromNative(decimal);
+        // fromNative reads the two words of the encoding right away, so the view into native memory needs no copy
+        return Decimal128Internal.fromNative(values.decimal128);
       case realm_value_type.RLM_TYPE_OBJECT_ID:
         return ObjectId.fromBytes(values.object_id.bytes.toList(12));
       case realm_value_type.RLM_TYPE_UUID:
@@ -296,14 +295,6 @@ enum CustomErrorCode {
   const CustomErrorCode(this.code);
 }
 
-enum HttpMethod {
-  get,
-  post,
-  patch,
-  put,
-  delete,
-}
-
 extension RealmTimestampEx on realm_timestamp_t {
   DateTime toDart() {
     return DateTime.fromMicrosecondsSinceEpoch(seconds * _microsecondsPerSecond + nanoseconds ~/ 1000, isUtc: true);
@@ -6,6 +6,7 @@ import 'dart:ffi';
 import 'package:realm_dart/realm.dart';
 
 import 'error_handling.dart';
+import 'realm_bindings.dart';
 import 'realm_library.dart';
 
 import '../handle_base.dart' as intf;
@@ -36,22 +37,133 @@ void _tearDownFinalizationTrace(Object value, Object finalizationToken) {
   _traceFinalization(finalizationToken);
 }
 
+/// A handle sampled by [HandleSampler], with the type it was created as, one of the
+/// [realm_dart_handle_type] constants.
+typedef HandleSample = ({int type, DateTime createdAt, StackTrace stackTrace});
+
+/// Records where a sample of the handles owned by this isolate were created, to hunt for
+/// leaks. Capturing stack traces is expensive, so it is off until [interval] is set.
+abstract final class HandleSampler {
+  static int _interval = 0;
+  static int _countdown = 0;
+  static int _nextId = 0;
+  static final _samples = <int, (WeakReference<HandleBase>, HandleSample)>{};
+  static final _finalizer = Finalizer<int>(_samples.remove);
+
+  /// One in [interval] handles is sampled, or none if it is 0.
+  static int get interval => _interval;
+  static set interval(int value) {
+    RangeError.checkNotNegative(value, 'interval');
+    _interval = _countdown = value;
+  }
+
+  static void _track(HandleBase handle) {
+    if (--_countdown > 0) {
+      return;
+    }
+    _countdown = _interval;
+    final id = _nextId++;
+    _samples[id] = (WeakReference(handle), (type: handle._type, createdAt: DateTime.now(), stackTrace: StackTrace.current));
+    _finalizer.attach(handle, id);
+  }
+
+  /// The samples of the handles that still hold their native object, oldest first.
+  static List<HandleSample> get liveSamples => [
+        for (final (handle, sample) in _samples.values)
+          if (handle.target?.released == false) sample,
+      ];
+}
+
+/// Lends pointers to borrowed handles, which need no finalizer of their own.
+/// The pointers stay valid as long as the lender, which the borrowed handles keep alive.
+abstract interface class HandleLender<T extends NativeType> {
+  /// Whether the lender still lends out its pointers. Once it stops, borrowed handles
+  /// promote themselves on their next use, so they no longer keep the lender alive.
+  bool get isLending;
+
+  /// Whether the lender itself is released, in which case its pointers can't be promoted either.
+  bool get released;
+
+  /// Whether the lender was released because the scope it was created in ended.
+  bool get releasedByScope;
+
+  /// Returns a pointer owned by the caller to the same object as the one lent out at [slot].
+  Pointer<T> promote(int slot);
+}
+
 abstract class HandleBase<T extends NativeType> implements Finalizable, intf.HandleBase {
   late Pointer<Void> _finalizableHandle;
   Pointer<T> _pointer;
   Pointer<T> get pointer {
     if (released) throw RealmError('Trying to access a released handle');
+    return _resolved;
+  }
+
+  HandleLender<T>? _lender;
+  int _slot = 0;
+  int _type = 0;
+
+  /// Whether this handle uses a pointer lent to it, rather than one it owns.
+  bool get isBorrowed => _lender != null;
+
+  // A borrowed handle used after its lender has stopped lending is
+  // promoted to an owned one, with a finalizer like any other handle. Once the
+  // handle or its lender is released, there is nothing left to resolve.
+  Pointer<T> get _resolved {
+    if (released) return nullptr;
+    final lender = _lender;
+    if (lender != null && !lender.isLending) {
+      _promote(lender);
+    }
     return _pointer;
   }
 
+  void _promote(HandleLender<T> lender) {
+    final owned = lender.promote(_slot).raiseLastErrorIfNull();
+    _lender = null;
+    _pointer = owned;
+    _finalizableHandle = realmLib.realm_attach_finalizer(this, owned.cast(), _type);
+    if (HandleSampler._interval > 0) {
+      HandleSampler._track(this);
+    }
+    onPromoted();
+  }
+
+  /// Promotes a borrowed handle to an owned one right away, so it no longer
+  /// depends on its lender.
+  void ensureOwned() {
+    final lender = _lender;
+    if (lender != null && !released) {
+      _promote(lender);
+    }
+  }
+
   @override
-  bool get released => _pointer == nullptr;
+  bool get released => _pointer == nullptr || (_lender?.released ?? false);
+
+  /// Whether the handle was released because the scope it was created in ended,
+  /// rather than with its realm.
+  @override
+  bool get releasedByScope => _lender?.releasedByScope ?? false;
+
+  /// @nodoc
+  /// The native finalizer of an owned handle, which also identifies it to the native registry of its root.
+  Pointer<Void> get finalizer => _finalizableHandle;
+
   @override
   final bool isUnowned;
 
-  HandleBase(this._pointer, int size) : isUnowned = false {
+  /// A handle owning [_pointer], which is released when the handle is garbage collected.
+  /// The native size reported to the GC is measured according to [type], one of
+  /// the [realm_dart_handle_type] constants.
+  HandleBase(this._pointer, int type)
+      : isUnowned = false,
+        _type = type {
     _pointer.raiseLastErrorIfNull();
-    _finalizableHandle = realmLib.realm_attach_finalizer(this, pointer.cast(), size);
+    _finalizableHandle = realmLib.realm_attach_finalizer(this, pointer.cast(), type);
+    if (HandleSampler._interval > 0) {
+      HandleSampler._track(this);
+    }
 
     if (_enableFinalizerTrace) {
       _setupFinalizationTrace(this, _pointer);
@@ -62,8 +174,31 @@ abstract class HandleBase<T extends NativeType> implements Finalizable, intf.Han
     _pointer.raiseLastErrorIfNull();
   }
 
+  /// A handle to a pointer owned by [lender] at [slot]. [type] is used if the
+  /// handle is ever promoted to an owned one.
+  HandleBase.borrowed(this._pointer, HandleLender<T> lender, int slot, int type)
+      : isUnowned = false,
+        _lender = lender,
+        _slot = slot,
+        _type = type {
+    _pointer.raiseLastErrorIfNull();
+  }
+
   @override
-  String toString() => "${_pointer.toString()} value=${_pointer.cast<IntPtr>().value}${isUnowned ? ' (unowned)' : ''}";
+  String toString() =>
+      "${_pointer.toString()} value=${_pointer.cast<IntPtr>().value}${isUnowned ? ' (unowned)' : ''}${isBorrowed ? ' (borrowed)' : ''}";
+
+  /// @nodoc
+  /// A method that will be invoked when a borrowed handle is promoted to an owned one.
+  void onPromoted() {}
+
+  /// Measures the native object again and reports its new size to the GC, for
+  /// handles whose native object grows after it is created.
+  void updateNativeSize() {
+    if (!released && !isUnowned && !isBorrowed) {
+      realmLib.realm_dart_update_finalizer_size(_finalizableHandle, this);
+    }
+  }
 
   /// @nodoc
   /// A method that will be invoked just before the handle is released. Allows to cleanup
@@ -79,13 +214,14 @@ abstract class HandleBase<T extends NativeType> implements Finalizable, intf.Han
 
     releaseCore();
 
-    if (!isUnowned) {
+    if (!isUnowned && !isBorrowed) {
       realmLib.realm_detach_finalizer(_finalizableHandle, this);
 
       realmLib.realm_release(_pointer.cast());
     }
 
     _pointer = nullptr;
+    _lender = null;
 
     if (_enableFinalizerTrace) {
       _tearDownFinalizationTrace(this, _pointer);
@@ -95,8 +231,8 @@ abstract class HandleBase<T extends NativeType> implements Finalizable, intf.Han
   @override
   // ignore: hash_and_equals
   bool operator ==(Object other) => other is HandleBase<T>
-      ? _pointer == other._pointer
+      ? _resolved == other._resolved
           ? true
-          : realmLib.realm_equals(_pointer.cast(), other._pointer.cast())
+          : realmLib.realm_equals(_resolved.cast(), other._resolved.cast())
       : false;
 }
@@ -2,9 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 import 'dart:async';
-import 'dart:convert';
 import 'dart:ffi';
 import 'dart:io';
+import 'dart:typed_data';
 
 import 'package:http/http.dart';
 
@@ -18,20 +18,32 @@ import 'realm_library.dart';
 import 'scheduler_handle.dart';
 
 class HttpTransportHandle extends HandleBase<realm_http_transport> {
-  HttpTransportHandle(Pointer<realm_http_transport> pointer) : super(pointer, 24);
+  HttpTransportHandle(Pointer<realm_http_transport> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_HTTP_TRANSPORT);
 
-  factory HttpTransportHandle.from(Client httpClient) {
-    final requestCallback = Pointer.fromFunction<Void Function(Handle, realm_http_request, Pointer<Void>)>(_requestCallback);
-    final requestCallbackUserdata = realmLib.realm_dart_userdata_async_new(httpClient, requestCallback.cast(), schedulerHandle.pointer);
+  factory HttpTransportHandle.from(Client httpClient, Pointer<realm_dart_http_metrics_t> metrics) {
+    final requestCallback = Pointer.fromFunction<Void Function(Handle, realm_http_request, Pointer<Void>, Uint64)>(_requestCallback);
+    final requestCallbackUserdata =
+        realmLib.realm_dart_userdata_async_new(_HttpTransport(httpClient, metrics), requestCallback.cast(), schedulerHandle.callbacksPointer);
     return HttpTransportHandle(realmLib.realm_http_transport_new(
       realmLib.addresses.realm_dart_http_request_callback,
       requestCallbackUserdata.cast(),
       realmLib.addresses.realm_dart_userdata_async_free,
     ));
   }
+
+  /// A transport performing the requests natively, without calling back into the isolate.
+  factory HttpTransportHandle.native(Pointer<realm_dart_http_metrics_t> metrics) =>
+      HttpTransportHandle(realmLib.realm_dart_native_http_transport_new(metrics));
 }
 
-void _requestCallback(Object userData, realm_http_request request, Pointer<Void> requestContext) {
+class _HttpTransport {
+  final Client client;
+  final Pointer<realm_dart_http_metrics_t> metrics;
+
+  _HttpTransport(this.client, this.metrics);
+}
+
+void _requestCallback(Object userData, realm_http_request request, Pointer<Void> requestContext, int queuedUs) {
   //
   // The request struct only survives until end-of-call, even though
   // we explicitly call realm_http_transport_complete_request to
@@ -40,68 +52,90 @@ void _requestCallback(Object userData, realm_http_request request, Pointer<Void>
   // Therefore we need to copy everything out of request before returning.
   // We cannot clone request on the native side with realm_clone,
   // since realm_http_request does not inherit from WrapC.
+  //
+  // The body is the exception. It is a copy the native side hands over
+  // to us, which is read in place and freed when the list is collected.
+  // Until the list takes it over, it is freed here if anything throws.
+  var bodyTakenOver = false;
+  try {
+    final transport = userData as _HttpTransport;
+    realmLib.realm_dart_http_metrics_request_started(transport.metrics, request.method, request.url);
+
+    final timeLimit = Duration(milliseconds: request.timeout_ms);
+
+    final url = request.url.cast<Utf8>().toRealmDartString()!;
+
+    final body = request.body == nullptr
+        ? Uint8List(0)
+        : request.body.cast<Uint8>().asTypedList(request.body_size, finalizer: realmLib.addresses.realm_dart_http_request_body_free);
+    bodyTakenOver = true;
+
+    final headers = <String, String>{};
+    for (int i = 0; i < request.num_headers; ++i) {
+      final header = request.headers[i];
+      final name = header.name.cast<Utf8>().toRealmDartString()!;
+      final value = header.value.cast<Utf8>().toRealmDartString()!;
+      headers[name] = value;
+    }
 
-  final client = userData as Client;
-
-  final timeLimit = Duration(milliseconds: request.timeout_ms);
-
-  final url = Uri.parse(request.url.cast<Utf8>().toRealmDartString()!);
-
-  final body = request.body.cast<Utf8>().toRealmDartString(length: request.body_size);
-
-  final headers = <String, String>{};
-  for (int i = 0; i < request.num_headers; ++i) {
-    final header = request.headers[i];
-    final name = header.name.cast<Utf8>().toRealmDartString()!;
-    final value = header.value.cast<Utf8>().toRealmDartString()!;
-    headers[name] = value;
+    _requestCallbackAsync(transport, request.method, url, body, headers, timeLimit, requestContext, queuedUs);
+  } finally {
+    if (!bodyTakenOver && request.body != nullptr) {
+      realmLib.realm_dart_http_request_body_free(request.body.cast());
+    }
   }
-
-  _requestCallbackAsync(client, request.method, url, body, headers, timeLimit, requestContext);
   // The request struct dies here!
 }
 
 Future<void> _requestCallbackAsync(
-  Client client,
+  _HttpTransport transport,
   int requestMethod,
-  Uri url,
-  String? body,
+  String url,
+  Uint8List body,
   Map<String, String> headers,
   Duration timeLimit,
   Pointer<Void> requestContext,
+  int queuedUs,
 ) async {
   await using((arena) async {
     final responsePointer = arena<realm_http_response>();
     final responseRef = responsePointer.ref;
     final method = HttpMethod.values[requestMethod];
+    final stopwatch = Stopwatch()..start();
+    var outcome = realm_dart_http_outcome.RLM_DART_HTTP_OUTCOME_ERROR;
+    var firstByteUs = 0;
+    var bodySize = 0;
 
     try {
       // Build request
-      final request = Request(method.name, url);
+      final request = Request(method.name, Uri.parse(url));
       for (final header in headers.entries) {
         request.headers[header.key] = header.value;
       }
 
-      if (body != null) {
-        request.bodyBytes = utf8.encode(body);
+      if (body.isNotEmpty) {
+        request.bodyBytes = body; // not copied, as it is already a Uint8List
       }
 
       Realm.logger.log(LogLevel.debug, "HTTP Transport: Executing ${method.name} $url");
 
-      final stopwatch = Stopwatch()..start();
-
       // Do the call..
-      final response = await client.send(request).timeout(timeLimit);
+      final response = await transport.client.send(request).timeout(timeLimit);
 
-      stopwatch.stop();
+      firstByteUs = queuedUs + stopwatch.elapsedMicroseconds;
       Realm.logger.log(LogLevel.debug, "HTTP Transport: Executed ${method.name} $url: ${response.statusCode} in ${stopwatch.elapsedMilliseconds} ms");
 
-      final responseBody = await response.stream.fold<List<int>>([], (acc, l) => acc..addAll(l)); // gather response
+      // gather response, keeping the chunks as received so they are copied only once
+      final chunks = <List<int>>[];
+      await for (final chunk in response.stream) {
+        chunks.add(chunk);
+        bodySize += chunk.length;
+      }
 
       // Report back to core
       responseRef.status_code = response.statusCode;
-      responseRef.body = responseBody.toCharPtr(arena);
-      responseRef.body_size = responseBody.length;
+      responseRef.body = _copyChunks(chunks, bodySize, arena);
+      responseRef.body_size = bodySize;
 
       int headerCnt = response.headers.length;
       responseRef.headers = arena<realm_http_header>(headerCnt);
@@ -116,12 +150,15 @@ Future<void> _requestCallbackAsync(
       });
 
       responseRef.custom_status_code = CustomErrorCode.noError.code;
+      outcome = realm_dart_http_outcome.RLM_DART_HTTP_OUTCOME_COMPLETED;
     } on TimeoutException catch (timeoutEx) {
       Realm.logger.log(LogLevel.warn, "HTTP Transport: TimeoutException executing ${method.name} $url: $timeoutEx");
       responseRef.custom_status_code = CustomErrorCode.timeout.code;
+      outcome = realm_dart_http_outcome.RLM_DART_HTTP_OUTCOME_TIMEOUT;
     } on SocketException catch (socketEx) {
       Realm.logger.log(LogLevel.warn, "HTTP Transport: SocketException executing ${method.name} $url: $socketEx");
       responseRef.custom_status_code = CustomErrorCode.socketException.code;
+      outcome = realm_dart_http_outcome.RLM_DART_HTTP_OUTCOME_SOCKET_ERROR;
     } on HttpException catch (httpEx) {
       Realm.logger.log(LogLevel.warn, "HTTP Transport: HttpException executing ${method.name} $url: $httpEx");
       responseRef.custom_status_code = CustomErrorCode.unknownHttp.code;
@@ -129,7 +166,26 @@ Future<void> _requestCallbackAsync(
       Realm.logger.log(LogLevel.error, "HTTP Transport: Exception executing ${method.name} $url: $ex");
       responseRef.custom_status_code = CustomErrorCode.unknown.code;
     } finally {
+      final latencyUs = queuedUs + stopwatch.elapsedMicroseconds;
+      // the url as received, so the request is recorded against the same endpoint it was started on
+      realmLib.realm_dart_http_metrics_request_completed(transport.metrics, requestMethod, url.toCharPtr(arena), outcome, body.length, bodySize,
+          queuedUs, outcome == realm_dart_http_outcome.RLM_DART_HTTP_OUTCOME_COMPLETED ? firstByteUs : latencyUs, latencyUs);
       realmLib.realm_http_transport_complete_request(requestContext, responsePointer);
     }
   });
 }
+
+Pointer<Char> _copyChunks(List<List<int>> chunks, int size, Arena arena) {
+  if (size == 0) {
+    return arena<Char>();
+  }
+  // malloc, as the buffer is overwritten right away and need not be zeroed like arena allocations
+  final buffer = arena.using(malloc<Uint8>(size), malloc.free);
+  final bytes = buffer.asTypedList(size);
+  var offset = 0;
+  for (final chunk in chunks) {
+    bytes.setAll(offset, chunk);
+    offset += chunk.length;
+  }
+  return buffer.cast();
+}
@@ -19,7 +19,7 @@ import 'results_handle.dart';
 import '../list_handle.dart' as intf;
 
 class ListHandle extends CollectionHandleBase<realm_list> implements intf.ListHandle {
-  ListHandle(Pointer<realm_list> pointer, RealmHandle root) : super(root, pointer, 88);
+  ListHandle(Pointer<realm_list> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_LIST);
 
   @override
   bool get isValid => realmLib.realm_list_is_valid(pointer);
@@ -13,7 +13,7 @@ import 'realm_library.dart';
 import '../map_changes_handle.dart' as intf;
 
 class MapChangesHandle extends HandleBase<realm_dictionary_changes> implements intf.MapChangesHandle {
-  MapChangesHandle(Pointer<realm_dictionary_changes> pointer) : super(pointer, 256);
+  MapChangesHandle(Pointer<realm_dictionary_changes> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CHANGES);
 
   @override
   MapChanges get changes {
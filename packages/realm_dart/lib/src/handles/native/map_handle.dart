@@ -20,7 +20,7 @@ import 'results_handle.dart';
 import '../map_handle.dart' as intf;
 
 class MapHandle extends CollectionHandleBase<realm_dictionary> implements intf.MapHandle {
-  MapHandle(Pointer<realm_dictionary> pointer, RealmHandle root) : super(root, pointer, 96); // TODO: check size
+  MapHandle(Pointer<realm_dictionary> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_DICTIONARY);
 
   @override
   int get size {
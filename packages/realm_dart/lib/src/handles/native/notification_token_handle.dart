@@ -11,7 +11,11 @@ import 'rooted_handle.dart';
 import '../notification_token_handle.dart' as intf;
 
 class NotificationTokenHandle extends RootedHandleBase<realm_notification_token> implements intf.NotificationTokenHandle {
-  NotificationTokenHandle(Pointer<realm_notification_token> pointer, RealmHandle root) : super(root, pointer, 32);
+  NotificationTokenHandle(Pointer<realm_notification_token> pointer, RealmHandle root)
+      : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN);
+
+  @override
+  bool get isScoped => false;
 }
 
 void collectionChangeCallback(Pointer<Void> userdata, Pointer<realm_collection_changes> data) {
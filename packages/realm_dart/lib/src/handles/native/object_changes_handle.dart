@@ -11,7 +11,7 @@ import 'realm_library.dart';
 import '../object_changes_handle.dart' as intf;
 
 class ObjectChangesHandle extends HandleBase<realm_object_changes> implements intf.ObjectChangesHandle {
-  ObjectChangesHandle(Pointer<realm_object_changes> pointer) : super(pointer, 256);
+  ObjectChangesHandle(Pointer<realm_object_changes> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_CHANGES);
 
   @override
   bool get isDeleted {
@@ -10,6 +10,7 @@ import 'collection_handle_base.dart';
 import 'convert_native.dart';
 import 'error_handling.dart';
 import 'ffi.dart';
+import 'handle_base.dart';
 import 'list_handle.dart';
 import 'map_handle.dart';
 import 'notification_token_handle.dart';
@@ -24,7 +25,10 @@ import 'set_handle.dart';
 import '../object_handle.dart' as intf;
 
 class ObjectHandle extends RootedHandleBase<realm_object> implements intf.ObjectHandle {
-  ObjectHandle(Pointer<realm_object> pointer, RealmHandle root) : super(root, pointer, 112);
+  ObjectHandle(Pointer<realm_object> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_OBJECT);
+
+  ObjectHandle.borrowed(Pointer<realm_object> pointer, RealmHandle root, HandleLender<realm_object> lender, int slot)
+      : super.borrowed(root, pointer, lender, slot, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_OBJECT);
 
   @override
   ObjectHandle createEmbedded(int propertyKey) {
@@ -0,0 +1,48 @@
+// Copyright 2024 MongoDB, Inc.
+// SPDX-License-Identifier: Apache-2.0
+
+import 'dart:ffi';
+
+import 'error_handling.dart';
+import 'handle_base.dart';
+import 'object_handle.dart';
+import 'realm_bindings.dart';
+import 'realm_handle.dart';
+import 'realm_library.dart';
+import 'results_handle.dart';
+import 'rooted_handle.dart';
+
+import '../object_slab_handle.dart' as intf;
+
+/// Holds the objects borrowed by the [ObjectHandle]s created while iterating.
+/// The slab is the only finalizable handle, instead of one per object. Once iteration has
+/// moved past it, borrowed handles still in use promote themselves to owned copies of their
+/// object, and the slab is released with its objects when the last of them is gone.
+class ObjectSlabHandle extends RootedHandleBase<realm_dart_object_slab> implements intf.ObjectSlabHandle, HandleLender<realm_object> {
+  static const capacity = 256;
+
+  int _count = 0;
+  bool _lending = true;
+
+  ObjectSlabHandle._(Pointer<realm_dart_object_slab> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_OBJECT_SLAB);
+
+  factory ObjectSlabHandle(RealmHandle root) => ObjectSlabHandle._(realmLib.realm_dart_object_slab_new(capacity), root);
+
+  @override
+  bool get isFull => _count == capacity;
+
+  @override
+  bool get isLending => _lending && !released;
+
+  ObjectHandle borrowResultsObject(ResultsHandle results, int index) {
+    assert(_lending && !isFull);
+    final object = realmLib.realm_dart_object_slab_add_results_object(pointer, results.pointer, index).raiseLastErrorIfNull();
+    return ObjectHandle.borrowed(object, root, this, _count++);
+  }
+
+  @override
+  void stopLending() => _lending = false;
+
+  @override
+  Pointer<realm_object> promote(int slot) => realmLib.realm_dart_object_slab_promote(pointer, slot);
+}
@@ -10,7 +10,7 @@ import 'results_handle.dart';
 import 'rooted_handle.dart';
 
 class QueryHandle extends RootedHandleBase<realm_query> {
-  QueryHandle(Pointer<realm_query> pointer, RealmHandle root) : super(root, pointer, 256);
+  QueryHandle(Pointer<realm_query> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_QUERY);
 
   ResultsHandle findAll() {
     try {
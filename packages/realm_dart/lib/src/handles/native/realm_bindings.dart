@@ -2054,24 +2054,26 @@ class RealmLibrary {
               ffi.Pointer<ffi.Void>,
               realm_free_userdata_func_t)>();
 
-  /// for debugging only. Enable in realm_dart.cpp
-  /// RLM_API void realm_dart_gc();
+  /// Release realmPtr when handle is garbage collected. The size of the native object is measured
+  /// from realmPtr and reported to the Dart GC, and counted towards the live bytes of type.
+  ///
+  /// @return A finalizer to pass to realm_detach_finalizer and realm_dart_update_finalizer_size.
   ffi.Pointer<ffi.Void> realm_attach_finalizer(
     Object handle,
     ffi.Pointer<ffi.Void> realmPtr,
-    int size,
+    int type,
   ) {
     return _realm_attach_finalizer(
       handle,
       realmPtr,
-      size,
+      type,
     );
   }
 
   late final _realm_attach_finalizerPtr = _lookup<
       ffi.NativeFunction<
           ffi.Pointer<ffi.Void> Function(ffi.Handle, ffi.Pointer<ffi.Void>,
-              ffi.Int)>>('realm_attach_finalizer');
+              ffi.Int32)>>('realm_attach_finalizer');
   late final _realm_attach_finalizer = _realm_attach_finalizerPtr.asFunction<
       ffi.Pointer<ffi.Void> Function(Object, ffi.Pointer<ffi.Void>, int)>();
 
@@ -3436,6 +3438,53 @@ class RealmLibrary {
               ffi.Pointer<realm_thread_safe_reference_t>,
               ffi.Pointer<realm_async_error_t>)>();
 
+  /// Write log messages to a text file at path, from a background thread. Replaces any previously attached file sink.
+  ///
+  /// The file is memory mapped with a fixed size of max_file_size bytes. When it is full it is renamed to path.1,
+  /// path.1 to path.2 and so on, keeping at most max_file_count files. An existing file at path is rotated the same way.
+  /// The sink receives messages whether any isolate is attached or not, until realm_dart_detach_file_log_sink is called.
+  ///
+  /// Only messages of categories[i], and its subcategories, with at least levels[i] are written to the file, with more
+  /// specific categories taking precedence. The levels are in place before the sink receives its first message.
+  ///
+  /// @return true if the file could be created, false otherwise, with the error available from realm_get_last_error.
+  bool realm_dart_attach_file_log_sink(
+    ffi.Pointer<ffi.Char> path,
+    int max_file_size,
+    int max_file_count,
+    ffi.Pointer<ffi.Pointer<ffi.Char>> categories,
+    ffi.Pointer<ffi.Int32> levels,
+    int levels_count,
+  ) {
+    return _realm_dart_attach_file_log_sink(
+      path,
+      max_file_size,
+      max_file_count,
+      categories,
+      levels,
+      levels_count,
+    );
+  }
+
+  late final _realm_dart_attach_file_log_sinkPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Bool Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Uint64,
+              ffi.Uint32,
+              ffi.Pointer<ffi.Pointer<ffi.Char>>,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Size)>>('realm_dart_attach_file_log_sink');
+  late final _realm_dart_attach_file_log_sink =
+      _realm_dart_attach_file_log_sinkPtr.asFunction<
+          bool Function(
+              ffi.Pointer<ffi.Char>,
+              int,
+              int,
+              ffi.Pointer<ffi.Pointer<ffi.Char>>,
+              ffi.Pointer<ffi.Int32>,
+              int)>();
+
   void realm_dart_attach_logger(
     int port,
   ) {
@@ -3450,22 +3499,209 @@ class RealmLibrary {
   late final _realm_dart_attach_logger =
       _realm_dart_attach_loggerPtr.asFunction<void Function(int)>();
 
+  /// Register the native object of finalizer, as returned by realm_attach_finalizer, at level.
+  /// It is unregistered when the finalizer is detached or runs.
+  void realm_dart_child_registry_add(
+    ffi.Pointer<realm_dart_child_registry_t> registry,
+    ffi.Pointer<ffi.Void> finalizer,
+    int level,
+  ) {
+    return _realm_dart_child_registry_add(
+      registry,
+      finalizer,
+      level,
+    );
+  }
+
+  late final _realm_dart_child_registry_addPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>,
+              ffi.Size)>>('realm_dart_child_registry_add');
+  late final _realm_dart_child_registry_add =
+      _realm_dart_child_registry_addPtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>, int)>();
+
+  /// Move a registered finalizer to another level.
+  void realm_dart_child_registry_move(
+    ffi.Pointer<realm_dart_child_registry_t> registry,
+    ffi.Pointer<ffi.Void> finalizer,
+    int level,
+  ) {
+    return _realm_dart_child_registry_move(
+      registry,
+      finalizer,
+      level,
+    );
+  }
+
+  late final _realm_dart_child_registry_movePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>,
+              ffi.Size)>>('realm_dart_child_registry_move');
+  late final _realm_dart_child_registry_move =
+      _realm_dart_child_registry_movePtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>, int)>();
+
+  /// Create a registry of the handles to release together with a realm handle. Children are kept in levels,
+  /// level 0 for the children of the realm itself and one more for each nested scope. Release it with realm_release.
+  ffi.Pointer<realm_dart_child_registry_t> realm_dart_child_registry_new() {
+    return _realm_dart_child_registry_new();
+  }
+
+  late final _realm_dart_child_registry_newPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_dart_child_registry_t> Function()>>(
+      'realm_dart_child_registry_new');
+  late final _realm_dart_child_registry_new = _realm_dart_child_registry_newPtr
+      .asFunction<ffi.Pointer<realm_dart_child_registry_t> Function()>();
+
+  /// Release the native objects of the children registered at level and above. Their finalizers stay attached
+  /// until the Dart handles are garbage collected, but no longer hold anything.
+  void realm_dart_child_registry_release(
+    ffi.Pointer<realm_dart_child_registry_t> registry,
+    int level,
+  ) {
+    return _realm_dart_child_registry_release(
+      registry,
+      level,
+    );
+  }
+
+  late final _realm_dart_child_registry_releasePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Size)>>('realm_dart_child_registry_release');
+  late final _realm_dart_child_registry_release =
+      _realm_dart_child_registry_releasePtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_child_registry_t>, int)>();
+
+  /// Unregister a finalizer, which keeps its native object alive until it is detached or runs.
+  void realm_dart_child_registry_remove(
+    ffi.Pointer<ffi.Void> finalizer,
+  ) {
+    return _realm_dart_child_registry_remove(
+      finalizer,
+    );
+  }
+
+  late final _realm_dart_child_registry_removePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>(
+          'realm_dart_child_registry_remove');
+  late final _realm_dart_child_registry_remove =
+      _realm_dart_child_registry_removePtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>)>();
+
+  /// Get the process wide counters of the client reset callbacks.
+  void realm_dart_client_reset_get_metrics(
+    ffi.Pointer<realm_dart_client_reset_metrics_t> out_metrics,
+  ) {
+    return _realm_dart_client_reset_get_metrics(
+      out_metrics,
+    );
+  }
+
+  late final _realm_dart_client_reset_get_metricsPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(
+                  ffi.Pointer<realm_dart_client_reset_metrics_t>)>>(
+      'realm_dart_client_reset_get_metrics');
+  late final _realm_dart_client_reset_get_metrics =
+      _realm_dart_client_reset_get_metricsPtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_client_reset_metrics_t>)>();
+
+  void realm_dart_client_reset_userdata_free(
+    ffi.Pointer<ffi.Void> userdata,
+  ) {
+    return _realm_dart_client_reset_userdata_free(
+      userdata,
+    );
+  }
+
+  late final _realm_dart_client_reset_userdata_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>(
+          'realm_dart_client_reset_userdata_free');
+  late final _realm_dart_client_reset_userdata_free =
+      _realm_dart_client_reset_userdata_freePtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>)>();
+
+  /// Create the userdata for the client reset handler callbacks. A sync thread blocks at most timeout_ms for the
+  /// isolate to run a callback to completion, or indefinitely if it is zero. Free with realm_dart_client_reset_userdata_free,
+  /// which also releases any sync thread still waiting for a callback.
+  realm_dart_userdata_async_t realm_dart_client_reset_userdata_new(
+    Object handle,
+    ffi.Pointer<ffi.Void> callback,
+    ffi.Pointer<realm_scheduler_t> scheduler,
+    int timeout_ms,
+  ) {
+    return _realm_dart_client_reset_userdata_new(
+      handle,
+      callback,
+      scheduler,
+      timeout_ms,
+    );
+  }
+
+  late final _realm_dart_client_reset_userdata_newPtr = _lookup<
+      ffi.NativeFunction<
+          realm_dart_userdata_async_t Function(
+              ffi.Handle,
+              ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>,
+              ffi.Uint64)>>('realm_dart_client_reset_userdata_new');
+  late final _realm_dart_client_reset_userdata_new =
+      _realm_dart_client_reset_userdata_newPtr.asFunction<
+          realm_dart_userdata_async_t Function(Object, ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>, int)>();
+
+  /// Create a scheduler running work on a native event loop thread, shared by the whole process.
+  ///
+  /// Realms bound to this scheduler are confined to the event loop thread and must never be accessed
+  /// from Dart. Use it for realms core opens internally, such as the one behind an async open task,
+  /// so their work completes without waking the isolate.
+  ffi.Pointer<realm_scheduler_t> realm_dart_create_event_loop_scheduler() {
+    return _realm_dart_create_event_loop_scheduler();
+  }
+
+  late final _realm_dart_create_event_loop_schedulerPtr =
+      _lookup<ffi.NativeFunction<ffi.Pointer<realm_scheduler_t> Function()>>(
+          'realm_dart_create_event_loop_scheduler');
+  late final _realm_dart_create_event_loop_scheduler =
+      _realm_dart_create_event_loop_schedulerPtr
+          .asFunction<ffi.Pointer<realm_scheduler_t> Function()>();
+
+  /// Create a scheduler that delivers work on the isolate listening on port.
+  /// The returned scheduler delivers on the notifications lane.
+  ///
+  /// @param[out] out_scheduler_data The scheduler state. It is posted to port as wake-up message
+  /// and must be passed to realm_dart_scheduler_invoke.
+  /// It is valid for as long as the returned scheduler is alive.
   ffi.Pointer<realm_scheduler_t> realm_dart_create_scheduler(
     int isolateId,
     int port,
+    ffi.Pointer<ffi.Pointer<ffi.Void>> out_scheduler_data,
   ) {
     return _realm_dart_create_scheduler(
       isolateId,
       port,
+      out_scheduler_data,
     );
   }
 
   late final _realm_dart_create_schedulerPtr = _lookup<
-      ffi.NativeFunction<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_scheduler_t> Function(
+                  ffi.Uint64, Dart_Port, ffi.Pointer<ffi.Pointer<ffi.Void>>)>>(
+      'realm_dart_create_scheduler');
+  late final _realm_dart_create_scheduler =
+      _realm_dart_create_schedulerPtr.asFunction<
           ffi.Pointer<realm_scheduler_t> Function(
-              ffi.Uint64, Dart_Port)>>('realm_dart_create_scheduler');
-  late final _realm_dart_create_scheduler = _realm_dart_create_schedulerPtr
-      .asFunction<ffi.Pointer<realm_scheduler_t> Function(int, int)>();
+              int, int, ffi.Pointer<ffi.Pointer<ffi.Void>>)>();
 
   realm_decimal128_t realm_dart_decimal128_add(
     realm_decimal128_t x,
@@ -3486,6 +3722,118 @@ class RealmLibrary {
           realm_decimal128_t Function(
               realm_decimal128_t, realm_decimal128_t)>();
 
+  /// Compute out[i] = x[i] op y[i] for count elements. out may alias x or y.
+  ///
+  /// @return The IEEE 754 flags raised by any of the operations.
+  int realm_dart_decimal128_batch_binary(
+    int op,
+    ffi.Pointer<realm_decimal128_t> x,
+    ffi.Pointer<realm_decimal128_t> y,
+    ffi.Pointer<realm_decimal128_t> out,
+    int count,
+  ) {
+    return _realm_dart_decimal128_batch_binary(
+      op,
+      x,
+      y,
+      out,
+      count,
+    );
+  }
+
+  late final _realm_dart_decimal128_batch_binaryPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Uint32 Function(
+              ffi.Int32,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Size)>>('realm_dart_decimal128_batch_binary');
+  late final _realm_dart_decimal128_batch_binary =
+      _realm_dart_decimal128_batch_binaryPtr.asFunction<
+          int Function(
+              int,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              int)>();
+
+  /// Set out[i] to realm_dart_decimal128_compare_to(x[i], y[i]) for count elements.
+  void realm_dart_decimal128_batch_compare(
+    ffi.Pointer<realm_decimal128_t> x,
+    ffi.Pointer<realm_decimal128_t> y,
+    ffi.Pointer<ffi.Int32> out,
+    int count,
+  ) {
+    return _realm_dart_decimal128_batch_compare(
+      x,
+      y,
+      out,
+      count,
+    );
+  }
+
+  late final _realm_dart_decimal128_batch_comparePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Size)>>('realm_dart_decimal128_batch_compare');
+  late final _realm_dart_decimal128_batch_compare =
+      _realm_dart_decimal128_batch_comparePtr.asFunction<
+          void Function(ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>, ffi.Pointer<ffi.Int32>, int)>();
+
+  /// Reduce count values to a single one. The sum of no values is zero, while their minimum, maximum and average is NaN.
+  /// Minimum and maximum ignore NaNs, unless all values are NaN.
+  ///
+  /// @param out_flags If not null, receives the IEEE 754 flags raised by any of the operations.
+  realm_decimal128_t realm_dart_decimal128_batch_reduce(
+    int reduction,
+    ffi.Pointer<realm_decimal128_t> values,
+    int count,
+    ffi.Pointer<ffi.Uint32> out_flags,
+  ) {
+    return _realm_dart_decimal128_batch_reduce(
+      reduction,
+      values,
+      count,
+      out_flags,
+    );
+  }
+
+  late final _realm_dart_decimal128_batch_reducePtr = _lookup<
+      ffi.NativeFunction<
+          realm_decimal128_t Function(
+              ffi.Int32,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Size,
+              ffi.Pointer<ffi.Uint32>)>>('realm_dart_decimal128_batch_reduce');
+  late final _realm_dart_decimal128_batch_reduce =
+      _realm_dart_decimal128_batch_reducePtr.asFunction<
+          realm_decimal128_t Function(int, ffi.Pointer<realm_decimal128_t>, int,
+              ffi.Pointer<ffi.Uint32>)>();
+
+  /// Sort count values in place, in the total order of realm_dart_decimal128_compare_to.
+  void realm_dart_decimal128_batch_sort(
+    ffi.Pointer<realm_decimal128_t> values,
+    int count,
+  ) {
+    return _realm_dart_decimal128_batch_sort(
+      values,
+      count,
+    );
+  }
+
+  late final _realm_dart_decimal128_batch_sortPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<realm_decimal128_t>,
+              ffi.Size)>>('realm_dart_decimal128_batch_sort');
+  late final _realm_dart_decimal128_batch_sort =
+      _realm_dart_decimal128_batch_sortPtr
+          .asFunction<void Function(ffi.Pointer<realm_decimal128_t>, int)>();
+
   int realm_dart_decimal128_compare_to(
     realm_decimal128_t x,
     realm_decimal128_t y,
@@ -3728,6 +4076,59 @@ class RealmLibrary {
       _realm_dart_decimal128_to_stringPtr
           .asFunction<realm_string_t Function(realm_decimal128_t)>();
 
+  /// Format count values into buffer, back to back and without terminating zeros.
+  ///
+  /// Value i spans from out_ends[i - 1] (or 0) to out_ends[i]. Formatting stops at the first value
+  /// that doesn't fit in buffer_size bytes.
+  ///
+  /// @return The number of values formatted.
+  int realm_dart_decimal128_to_string_batch(
+    ffi.Pointer<realm_decimal128_t> values,
+    int count,
+    ffi.Pointer<ffi.Char> buffer,
+    int buffer_size,
+    ffi.Pointer<ffi.Uint32> out_ends,
+  ) {
+    return _realm_dart_decimal128_to_string_batch(
+      values,
+      count,
+      buffer,
+      buffer_size,
+      out_ends,
+    );
+  }
+
+  late final _realm_dart_decimal128_to_string_batchPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Size Function(ffi.Pointer<realm_decimal128_t>, ffi.Size,
+                  ffi.Pointer<ffi.Char>, ffi.Size, ffi.Pointer<ffi.Uint32>)>>(
+      'realm_dart_decimal128_to_string_batch');
+  late final _realm_dart_decimal128_to_string_batch =
+      _realm_dart_decimal128_to_string_batchPtr.asFunction<
+          int Function(ffi.Pointer<realm_decimal128_t>, int,
+              ffi.Pointer<ffi.Char>, int, ffi.Pointer<ffi.Uint32>)>();
+
+  /// Format x into buffer, which must hold at least RLM_DART_DECIMAL128_STRING_BUFFER_SIZE bytes.
+  ///
+  /// @return The length of the string written to buffer, not including the terminating zero.
+  int realm_dart_decimal128_to_string_buffer(
+    realm_decimal128_t x,
+    ffi.Pointer<ffi.Char> buffer,
+  ) {
+    return _realm_dart_decimal128_to_string_buffer(
+      x,
+      buffer,
+    );
+  }
+
+  late final _realm_dart_decimal128_to_string_bufferPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Size Function(realm_decimal128_t, ffi.Pointer<ffi.Char>)>>(
+      'realm_dart_decimal128_to_string_buffer');
+  late final _realm_dart_decimal128_to_string_buffer =
+      _realm_dart_decimal128_to_string_bufferPtr.asFunction<
+          int Function(realm_decimal128_t, ffi.Pointer<ffi.Char>)>();
+
   void realm_dart_delete_persistent_handle(
     ffi.Pointer<ffi.Void> handle,
   ) {
@@ -3743,6 +4144,16 @@ class RealmLibrary {
       _realm_dart_delete_persistent_handlePtr
           .asFunction<void Function(ffi.Pointer<ffi.Void>)>();
 
+  void realm_dart_detach_file_log_sink() {
+    return _realm_dart_detach_file_log_sink();
+  }
+
+  late final _realm_dart_detach_file_log_sinkPtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function()>>(
+          'realm_dart_detach_file_log_sink');
+  late final _realm_dart_detach_file_log_sink =
+      _realm_dart_detach_file_log_sinkPtr.asFunction<void Function()>();
+
   void realm_dart_detach_logger(
     int port,
   ) {
@@ -3799,6 +4210,22 @@ class RealmLibrary {
   late final _realm_dart_get_files_path = _realm_dart_get_files_pathPtr
       .asFunction<ffi.Pointer<ffi.Char> Function()>();
 
+  /// Get the census of the handles of each of the RLM_DART_HANDLE_TYPE_COUNT handle types.
+  void realm_dart_get_handle_stats(
+    ffi.Pointer<realm_dart_handle_stats_t> out_stats,
+  ) {
+    return _realm_dart_get_handle_stats(
+      out_stats,
+    );
+  }
+
+  late final _realm_dart_get_handle_statsPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<realm_dart_handle_stats_t>)>>(
+      'realm_dart_get_handle_stats');
+  late final _realm_dart_get_handle_stats = _realm_dart_get_handle_statsPtr
+      .asFunction<void Function(ffi.Pointer<realm_dart_handle_stats_t>)>();
+
   int realm_dart_get_thread_id() {
     return _realm_dart_get_thread_id();
   }
@@ -3809,6 +4236,131 @@ class RealmLibrary {
   late final _realm_dart_get_thread_id =
       _realm_dart_get_thread_idPtr.asFunction<int Function()>();
 
+  /// Get the HTTP metrics of an app. They are shared by all isolates and never freed.
+  ffi.Pointer<realm_dart_http_metrics_t> realm_dart_http_metrics_get(
+    ffi.Pointer<ffi.Char> app_id,
+  ) {
+    return _realm_dart_http_metrics_get(
+      app_id,
+    );
+  }
+
+  late final _realm_dart_http_metrics_getPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_dart_http_metrics_t> Function(
+              ffi.Pointer<ffi.Char>)>>('realm_dart_http_metrics_get');
+  late final _realm_dart_http_metrics_get =
+      _realm_dart_http_metrics_getPtr.asFunction<
+          ffi.Pointer<realm_dart_http_metrics_t> Function(
+              ffi.Pointer<ffi.Char>)>();
+
+  /// Copy the metrics of up to capacity endpoints to out_endpoints. Returns the number of endpoints with metrics,
+  /// which may be more than capacity. The paths remain valid for the lifetime of the process.
+  int realm_dart_http_metrics_get_endpoints(
+    ffi.Pointer<realm_dart_http_metrics_t> metrics,
+    ffi.Pointer<realm_dart_http_endpoint_metrics_t> out_endpoints,
+    int capacity,
+  ) {
+    return _realm_dart_http_metrics_get_endpoints(
+      metrics,
+      out_endpoints,
+      capacity,
+    );
+  }
+
+  late final _realm_dart_http_metrics_get_endpointsPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Size Function(
+              ffi.Pointer<realm_dart_http_metrics_t>,
+              ffi.Pointer<realm_dart_http_endpoint_metrics_t>,
+              ffi.Size)>>('realm_dart_http_metrics_get_endpoints');
+  late final _realm_dart_http_metrics_get_endpoints =
+      _realm_dart_http_metrics_get_endpointsPtr.asFunction<
+          int Function(ffi.Pointer<realm_dart_http_metrics_t>,
+              ffi.Pointer<realm_dart_http_endpoint_metrics_t>, int)>();
+
+  /// Record the outcome and timings of a request to url.
+  void realm_dart_http_metrics_request_completed(
+    ffi.Pointer<realm_dart_http_metrics_t> metrics,
+    int method,
+    ffi.Pointer<ffi.Char> url,
+    int outcome,
+    int bytes_sent,
+    int bytes_received,
+    int queue_us,
+    int first_byte_us,
+    int latency_us,
+  ) {
+    return _realm_dart_http_metrics_request_completed(
+      metrics,
+      method,
+      url,
+      outcome,
+      bytes_sent,
+      bytes_received,
+      queue_us,
+      first_byte_us,
+      latency_us,
+    );
+  }
+
+  late final _realm_dart_http_metrics_request_completedPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_http_metrics_t>,
+              ffi.Int32,
+              ffi.Pointer<ffi.Char>,
+              ffi.Int32,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64)>>('realm_dart_http_metrics_request_completed');
+  late final _realm_dart_http_metrics_request_completed =
+      _realm_dart_http_metrics_request_completedPtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_http_metrics_t>, int,
+              ffi.Pointer<ffi.Char>, int, int, int, int, int, int)>();
+
+  /// Record that a request to url was started. Every started request must be completed.
+  void realm_dart_http_metrics_request_started(
+    ffi.Pointer<realm_dart_http_metrics_t> metrics,
+    int method,
+    ffi.Pointer<ffi.Char> url,
+  ) {
+    return _realm_dart_http_metrics_request_started(
+      metrics,
+      method,
+      url,
+    );
+  }
+
+  late final _realm_dart_http_metrics_request_startedPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<realm_dart_http_metrics_t>,
+                  ffi.Int32, ffi.Pointer<ffi.Char>)>>(
+      'realm_dart_http_metrics_request_started');
+  late final _realm_dart_http_metrics_request_started =
+      _realm_dart_http_metrics_request_startedPtr.asFunction<
+          void Function(ffi.Pointer<realm_dart_http_metrics_t>, int,
+              ffi.Pointer<ffi.Char>)>();
+
+  /// Free the body of a request passed to the Dart request callback. The body is handed over to the isolate,
+  /// which frees it once the list over it is garbage collected.
+  void realm_dart_http_request_body_free(
+    ffi.Pointer<ffi.Void> body,
+  ) {
+    return _realm_dart_http_request_body_free(
+      body,
+    );
+  }
+
+  late final _realm_dart_http_request_body_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>(
+          'realm_dart_http_request_body_free');
+  late final _realm_dart_http_request_body_free =
+      _realm_dart_http_request_body_freePtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>)>();
+
   void realm_dart_http_request_callback(
     ffi.Pointer<ffi.Void> userdata,
     realm_http_request_t request,
@@ -3902,6 +4454,107 @@ class RealmLibrary {
   late final _realm_dart_log = _realm_dart_logPtr.asFunction<
       void Function(int, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>();
 
+  /// Get the number of log messages dropped since process start, because they were logged faster than
+  /// they could be delivered to the attached isolates.
+  int realm_dart_logger_get_dropped_count() {
+    return _realm_dart_logger_get_dropped_count();
+  }
+
+  late final _realm_dart_logger_get_dropped_countPtr =
+      _lookup<ffi.NativeFunction<ffi.Uint64 Function()>>(
+          'realm_dart_logger_get_dropped_count');
+  late final _realm_dart_logger_get_dropped_count =
+      _realm_dart_logger_get_dropped_countPtr.asFunction<int Function()>();
+
+  /// Create an HTTP transport that performs the requests of an app natively, on a thread of its own,
+  /// without involving any isolate. Connections are kept alive and reused for requests to the same host.
+  ffi.Pointer<realm_http_transport_t> realm_dart_native_http_transport_new(
+    ffi.Pointer<realm_dart_http_metrics_t> metrics,
+  ) {
+    return _realm_dart_native_http_transport_new(
+      metrics,
+    );
+  }
+
+  late final _realm_dart_native_http_transport_newPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_http_transport_t> Function(
+                  ffi.Pointer<realm_dart_http_metrics_t>)>>(
+      'realm_dart_native_http_transport_new');
+  late final _realm_dart_native_http_transport_new =
+      _realm_dart_native_http_transport_newPtr.asFunction<
+          ffi.Pointer<realm_http_transport_t> Function(
+              ffi.Pointer<realm_dart_http_metrics_t>)>();
+
+  /// Get the object at index in results and keep it in the slab until the slab is released.
+  /// The slab must have room for it.
+  ///
+  /// @return The object, owned by the slab, or null if an error occurred.
+  ffi.Pointer<realm_object_t> realm_dart_object_slab_add_results_object(
+    ffi.Pointer<realm_dart_object_slab_t> slab,
+    ffi.Pointer<realm_results_t> results,
+    int index,
+  ) {
+    return _realm_dart_object_slab_add_results_object(
+      slab,
+      results,
+      index,
+    );
+  }
+
+  late final _realm_dart_object_slab_add_results_objectPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_object_t> Function(
+              ffi.Pointer<realm_dart_object_slab_t>,
+              ffi.Pointer<realm_results_t>,
+              ffi.Size)>>('realm_dart_object_slab_add_results_object');
+  late final _realm_dart_object_slab_add_results_object =
+      _realm_dart_object_slab_add_results_objectPtr.asFunction<
+          ffi.Pointer<realm_object_t> Function(
+              ffi.Pointer<realm_dart_object_slab_t>,
+              ffi.Pointer<realm_results_t>,
+              int)>();
+
+  /// Create a slab holding the objects borrowed by handles while iterating. Release it with realm_release.
+  ffi.Pointer<realm_dart_object_slab_t> realm_dart_object_slab_new(
+    int capacity,
+  ) {
+    return _realm_dart_object_slab_new(
+      capacity,
+    );
+  }
+
+  late final _realm_dart_object_slab_newPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_dart_object_slab_t> Function(
+              ffi.Size)>>('realm_dart_object_slab_new');
+  late final _realm_dart_object_slab_new = _realm_dart_object_slab_newPtr
+      .asFunction<ffi.Pointer<realm_dart_object_slab_t> Function(int)>();
+
+  /// Copy the object at slot, as an object owned by the caller. The copy refers to the same object as the slab does,
+  /// so it is invalid if that object was deleted, even if another object was created with the same key since.
+  ///
+  /// @return The object, or null if an error occurred.
+  ffi.Pointer<realm_object_t> realm_dart_object_slab_promote(
+    ffi.Pointer<realm_dart_object_slab_t> slab,
+    int slot,
+  ) {
+    return _realm_dart_object_slab_promote(
+      slab,
+      slot,
+    );
+  }
+
+  late final _realm_dart_object_slab_promotePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_object_t> Function(
+              ffi.Pointer<realm_dart_object_slab_t>,
+              ffi.Size)>>('realm_dart_object_slab_promote');
+  late final _realm_dart_object_slab_promote =
+      _realm_dart_object_slab_promotePtr.asFunction<
+          ffi.Pointer<realm_object_t> Function(
+              ffi.Pointer<realm_dart_object_slab_t>, int)>();
+
   ffi.Pointer<ffi.Void> realm_dart_object_to_persistent_handle(
     Object handle,
   ) {
@@ -3954,6 +4607,68 @@ class RealmLibrary {
           void Function(ffi.Pointer<ffi.Void>, ffi.Pointer<ffi.Char>,
               ffi.Pointer<realm_app_error_t>)>();
 
+  /// Create a scheduler sharing the wake-ups of the one created by realm_dart_create_scheduler,
+  /// but delivering on the given lane.
+  ffi.Pointer<realm_scheduler_t> realm_dart_scheduler_create_lane(
+    ffi.Pointer<ffi.Void> userData,
+    int lane,
+  ) {
+    return _realm_dart_scheduler_create_lane(
+      userData,
+      lane,
+    );
+  }
+
+  late final _realm_dart_scheduler_create_lanePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_scheduler_t> Function(ffi.Pointer<ffi.Void>,
+              ffi.Int32)>>('realm_dart_scheduler_create_lane');
+  late final _realm_dart_scheduler_create_lane =
+      _realm_dart_scheduler_create_lanePtr.asFunction<
+          ffi.Pointer<realm_scheduler_t> Function(
+              ffi.Pointer<ffi.Void>, int)>();
+
+  int realm_dart_scheduler_get_lane_depth(
+    ffi.Pointer<ffi.Void> userData,
+    int lane,
+  ) {
+    return _realm_dart_scheduler_get_lane_depth(
+      userData,
+      lane,
+    );
+  }
+
+  late final _realm_dart_scheduler_get_lane_depthPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Size Function(ffi.Pointer<ffi.Void>,
+              ffi.Int32)>>('realm_dart_scheduler_get_lane_depth');
+  late final _realm_dart_scheduler_get_lane_depth =
+      _realm_dart_scheduler_get_lane_depthPtr
+          .asFunction<int Function(ffi.Pointer<ffi.Void>, int)>();
+
+  void realm_dart_scheduler_get_stats(
+    ffi.Pointer<ffi.Void> userData,
+    ffi.Pointer<realm_dart_scheduler_stats_t> out_stats,
+  ) {
+    return _realm_dart_scheduler_get_stats(
+      userData,
+      out_stats,
+    );
+  }
+
+  late final _realm_dart_scheduler_get_statsPtr = _lookup<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<ffi.Void>,
+                  ffi.Pointer<realm_dart_scheduler_stats_t>)>>(
+      'realm_dart_scheduler_get_stats');
+  late final _realm_dart_scheduler_get_stats =
+      _realm_dart_scheduler_get_statsPtr.asFunction<
+          void Function(ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_dart_scheduler_stats_t>)>();
+
+  /// Run all work queued on the scheduler since the last wake-up, lane by lane.
+  ///
+  /// Must be called on the isolate owning the scheduler.
   void realm_dart_scheduler_invoke(
     int isolateId,
     ffi.Pointer<ffi.Void> userData,
@@ -3971,6 +4686,30 @@ class RealmLibrary {
   late final _realm_dart_scheduler_invoke = _realm_dart_scheduler_invokePtr
       .asFunction<void Function(int, ffi.Pointer<ffi.Void>)>();
 
+  /// Limit the time a single realm_dart_scheduler_invoke may spend running work.
+  ///
+  /// When the budget is spent the remaining work is re-posted to the isolate, so it runs on a later
+  /// turn of the event loop. At least one work queue is run per invocation.
+  ///
+  /// @param budget_us The budget in microseconds. Zero, the default, means no limit.
+  void realm_dart_scheduler_set_drain_budget(
+    ffi.Pointer<ffi.Void> userData,
+    int budget_us,
+  ) {
+    return _realm_dart_scheduler_set_drain_budget(
+      userData,
+      budget_us,
+    );
+  }
+
+  late final _realm_dart_scheduler_set_drain_budgetPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Void>,
+              ffi.Int64)>>('realm_dart_scheduler_set_drain_budget');
+  late final _realm_dart_scheduler_set_drain_budget =
+      _realm_dart_scheduler_set_drain_budgetPtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>, int)>();
+
   /// implemented for iOS only (for now - valid for all posix)
   /// /**
   ///  * Set the soft limit on number of open files
@@ -3998,6 +4737,30 @@ class RealmLibrary {
   late final _realm_dart_set_and_get_rlimit = _realm_dart_set_and_get_rlimitPtr
       .asFunction<bool Function(int, ffi.Pointer<ffi.Long>)>();
 
+  /// Only deliver messages of category, and its subcategories, with at least the given level to port.
+  ///
+  /// Messages no attached port wants are dropped before they are queued for delivery. Core's own level
+  /// for each category is lowered to the lowest threshold set by any port, so core only formats messages
+  /// some port wants. The filters of a port are cleared when it detaches.
+  void realm_dart_set_log_filter(
+    int port,
+    ffi.Pointer<ffi.Char> category,
+    int level,
+  ) {
+    return _realm_dart_set_log_filter(
+      port,
+      category,
+      level,
+    );
+  }
+
+  late final _realm_dart_set_log_filterPtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(Dart_Port, ffi.Pointer<ffi.Char>,
+              ffi.Int32)>>('realm_dart_set_log_filter');
+  late final _realm_dart_set_log_filter = _realm_dart_set_log_filterPtr
+      .asFunction<void Function(int, ffi.Pointer<ffi.Char>, int)>();
+
   bool realm_dart_sync_after_reset_handler_callback(
     ffi.Pointer<ffi.Void> userdata,
     ffi.Pointer<realm_t> before_realm,
@@ -4126,6 +4889,51 @@ class RealmLibrary {
       _realm_dart_sync_progress_callbackPtr
           .asFunction<void Function(ffi.Pointer<ffi.Void>, int, int, double)>();
 
+  void realm_dart_sync_progress_userdata_free(
+    ffi.Pointer<ffi.Void> userdata,
+  ) {
+    return _realm_dart_sync_progress_userdata_free(
+      userdata,
+    );
+  }
+
+  late final _realm_dart_sync_progress_userdata_freePtr =
+      _lookup<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>(
+          'realm_dart_sync_progress_userdata_free');
+  late final _realm_dart_sync_progress_userdata_free =
+      _realm_dart_sync_progress_userdata_freePtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>)>();
+
+  /// Create the userdata for realm_dart_sync_progress_callback. Ticks are coalesced, so at most one is waiting
+  /// on the isolate and deliveries are at least interval_ms apart, except for the tick completing the transfer.
+  /// The latest tick is always delivered, once interval_ms has passed since the previous delivery.
+  /// Free with realm_dart_sync_progress_userdata_free.
+  realm_dart_userdata_async_t realm_dart_sync_progress_userdata_new(
+    Object handle,
+    ffi.Pointer<ffi.Void> callback,
+    ffi.Pointer<realm_scheduler_t> scheduler,
+    int interval_ms,
+  ) {
+    return _realm_dart_sync_progress_userdata_new(
+      handle,
+      callback,
+      scheduler,
+      interval_ms,
+    );
+  }
+
+  late final _realm_dart_sync_progress_userdata_newPtr = _lookup<
+      ffi.NativeFunction<
+          realm_dart_userdata_async_t Function(
+              ffi.Handle,
+              ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>,
+              ffi.Uint64)>>('realm_dart_sync_progress_userdata_new');
+  late final _realm_dart_sync_progress_userdata_new =
+      _realm_dart_sync_progress_userdata_newPtr.asFunction<
+          realm_dart_userdata_async_t Function(Object, ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>, int)>();
+
   void realm_dart_sync_wait_for_completion_callback(
     ffi.Pointer<ffi.Void> userdata,
     ffi.Pointer<realm_error_t> error,
@@ -4145,6 +4953,25 @@ class RealmLibrary {
       _realm_dart_sync_wait_for_completion_callbackPtr.asFunction<
           void Function(ffi.Pointer<ffi.Void>, ffi.Pointer<realm_error_t>)>();
 
+  /// Measure the native object of a finalizer again, for objects that grow after they are created, such as results.
+  void realm_dart_update_finalizer_size(
+    ffi.Pointer<ffi.Void> finalizer,
+    Object handle,
+  ) {
+    return _realm_dart_update_finalizer_size(
+      finalizer,
+      handle,
+    );
+  }
+
+  late final _realm_dart_update_finalizer_sizePtr = _lookup<
+      ffi.NativeFunction<
+          ffi.Void Function(ffi.Pointer<ffi.Void>,
+              ffi.Handle)>>('realm_dart_update_finalizer_size');
+  late final _realm_dart_update_finalizer_size =
+      _realm_dart_update_finalizer_sizePtr
+          .asFunction<void Function(ffi.Pointer<ffi.Void>, Object)>();
+
   void realm_dart_user_change_callback(
     ffi.Pointer<ffi.Void> userdata,
     int state,
@@ -4279,11 +5106,11 @@ class RealmLibrary {
       bool Function(ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Bool>)>();
 
   void realm_detach_finalizer(
-    ffi.Pointer<ffi.Void> finalizableHandle,
+    ffi.Pointer<ffi.Void> finalizer,
     Object handle,
   ) {
     return _realm_detach_finalizer(
-      finalizableHandle,
+      finalizer,
       handle,
     );
   }
@@ -11728,11 +12555,70 @@ class _SymbolAddresses {
                   ffi.Pointer<realm_async_error_t>)>>
       get realm_dart_async_open_task_callback =>
           _library._realm_dart_async_open_task_callbackPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Bool Function(
+              ffi.Pointer<ffi.Char>,
+              ffi.Uint64,
+              ffi.Uint32,
+              ffi.Pointer<ffi.Pointer<ffi.Char>>,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Size)>> get realm_dart_attach_file_log_sink =>
+      _library._realm_dart_attach_file_log_sinkPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(Dart_Port)>>
       get realm_dart_attach_logger => _library._realm_dart_attach_loggerPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>,
+              ffi.Size)>> get realm_dart_child_registry_add =>
+      _library._realm_dart_child_registry_addPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_child_registry_t>,
+              ffi.Pointer<ffi.Void>,
+              ffi.Size)>> get realm_dart_child_registry_move =>
+      _library._realm_dart_child_registry_movePtr;
+  ffi.Pointer<
+          ffi
+          .NativeFunction<ffi.Pointer<realm_dart_child_registry_t> Function()>>
+      get realm_dart_child_registry_new =>
+          _library._realm_dart_child_registry_newPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(
+                  ffi.Pointer<realm_dart_child_registry_t>, ffi.Size)>>
+      get realm_dart_child_registry_release =>
+          _library._realm_dart_child_registry_releasePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>
+      get realm_dart_child_registry_remove =>
+          _library._realm_dart_child_registry_removePtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(
+                  ffi.Pointer<realm_dart_client_reset_metrics_t>)>>
+      get realm_dart_client_reset_get_metrics =>
+          _library._realm_dart_client_reset_get_metricsPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>
+      get realm_dart_client_reset_userdata_free =>
+          _library._realm_dart_client_reset_userdata_freePtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          realm_dart_userdata_async_t Function(
+              ffi.Handle,
+              ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>,
+              ffi.Uint64)>> get realm_dart_client_reset_userdata_new =>
+      _library._realm_dart_client_reset_userdata_newPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Pointer<realm_scheduler_t> Function()>>
+      get realm_dart_create_event_loop_scheduler =>
+          _library._realm_dart_create_event_loop_schedulerPtr;
   ffi.Pointer<
           ffi.NativeFunction<
-              ffi.Pointer<realm_scheduler_t> Function(ffi.Uint64, Dart_Port)>>
+              ffi.Pointer<realm_scheduler_t> Function(
+                  ffi.Uint64, Dart_Port, ffi.Pointer<ffi.Pointer<ffi.Void>>)>>
       get realm_dart_create_scheduler =>
           _library._realm_dart_create_schedulerPtr;
   ffi.Pointer<
@@ -11740,6 +12626,37 @@ class _SymbolAddresses {
               realm_decimal128_t Function(
                   realm_decimal128_t, realm_decimal128_t)>>
       get realm_dart_decimal128_add => _library._realm_dart_decimal128_addPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Uint32 Function(
+              ffi.Int32,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Size)>> get realm_dart_decimal128_batch_binary =>
+      _library._realm_dart_decimal128_batch_binaryPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<realm_decimal128_t>,
+              ffi.Pointer<ffi.Int32>,
+              ffi.Size)>> get realm_dart_decimal128_batch_compare =>
+      _library._realm_dart_decimal128_batch_comparePtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              realm_decimal128_t Function(
+                  ffi.Int32,
+                  ffi.Pointer<realm_decimal128_t>,
+                  ffi.Size,
+                  ffi.Pointer<ffi.Uint32>)>>
+      get realm_dart_decimal128_batch_reduce =>
+          _library._realm_dart_decimal128_batch_reducePtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<realm_decimal128_t>, ffi.Size)>>
+      get realm_dart_decimal128_batch_sort =>
+          _library._realm_dart_decimal128_batch_sortPtr;
   ffi.Pointer<
           ffi.NativeFunction<
               ffi.Int Function(realm_decimal128_t, realm_decimal128_t)>>
@@ -11804,9 +12721,23 @@ class _SymbolAddresses {
   ffi.Pointer<ffi.NativeFunction<realm_string_t Function(realm_decimal128_t)>>
       get realm_dart_decimal128_to_string =>
           _library._realm_dart_decimal128_to_stringPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Size Function(ffi.Pointer<realm_decimal128_t>, ffi.Size,
+                  ffi.Pointer<ffi.Char>, ffi.Size, ffi.Pointer<ffi.Uint32>)>>
+      get realm_dart_decimal128_to_string_batch =>
+          _library._realm_dart_decimal128_to_string_batchPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Size Function(realm_decimal128_t, ffi.Pointer<ffi.Char>)>>
+      get realm_dart_decimal128_to_string_buffer =>
+          _library._realm_dart_decimal128_to_string_bufferPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>
       get realm_dart_delete_persistent_handle =>
           _library._realm_dart_delete_persistent_handlePtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function()>>
+      get realm_dart_detach_file_log_sink =>
+          _library._realm_dart_detach_file_log_sinkPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Void Function(Dart_Port)>>
       get realm_dart_detach_logger => _library._realm_dart_detach_loggerPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function()>>
@@ -11818,8 +12749,48 @@ class _SymbolAddresses {
           _library._realm_dart_get_device_versionPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<ffi.Char> Function()>>
       get realm_dart_get_files_path => _library._realm_dart_get_files_pathPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<realm_dart_handle_stats_t>)>>
+      get realm_dart_get_handle_stats =>
+          _library._realm_dart_get_handle_statsPtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Uint64 Function()>>
       get realm_dart_get_thread_id => _library._realm_dart_get_thread_idPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_dart_http_metrics_t> Function(
+                  ffi.Pointer<ffi.Char>)>>
+      get realm_dart_http_metrics_get =>
+          _library._realm_dart_http_metrics_getPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Size Function(
+              ffi.Pointer<realm_dart_http_metrics_t>,
+              ffi.Pointer<realm_dart_http_endpoint_metrics_t>,
+              ffi.Size)>> get realm_dart_http_metrics_get_endpoints =>
+      _library._realm_dart_http_metrics_get_endpointsPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Void Function(
+              ffi.Pointer<realm_dart_http_metrics_t>,
+              ffi.Int32,
+              ffi.Pointer<ffi.Char>,
+              ffi.Int32,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64,
+              ffi.Uint64)>> get realm_dart_http_metrics_request_completed =>
+      _library._realm_dart_http_metrics_request_completedPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<realm_dart_http_metrics_t>,
+                  ffi.Int32, ffi.Pointer<ffi.Char>)>>
+      get realm_dart_http_metrics_request_started =>
+          _library._realm_dart_http_metrics_request_startedPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>
+      get realm_dart_http_request_body_free =>
+          _library._realm_dart_http_request_body_freePtr;
   ffi.Pointer<
       ffi.NativeFunction<
           ffi.Void Function(ffi.Pointer<ffi.Void>, realm_http_request_t,
@@ -11843,6 +12814,32 @@ class _SymbolAddresses {
               ffi.Void Function(
                   ffi.Int32, ffi.Pointer<ffi.Char>, ffi.Pointer<ffi.Char>)>>
       get realm_dart_log => _library._realm_dart_logPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Uint64 Function()>>
+      get realm_dart_logger_get_dropped_count =>
+          _library._realm_dart_logger_get_dropped_countPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_http_transport_t> Function(
+                  ffi.Pointer<realm_dart_http_metrics_t>)>>
+      get realm_dart_native_http_transport_new =>
+          _library._realm_dart_native_http_transport_newPtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          ffi.Pointer<realm_object_t> Function(
+              ffi.Pointer<realm_dart_object_slab_t>,
+              ffi.Pointer<realm_results_t>,
+              ffi.Size)>> get realm_dart_object_slab_add_results_object =>
+      _library._realm_dart_object_slab_add_results_objectPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_dart_object_slab_t> Function(ffi.Size)>>
+      get realm_dart_object_slab_new => _library._realm_dart_object_slab_newPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_object_t> Function(
+                  ffi.Pointer<realm_dart_object_slab_t>, ffi.Size)>>
+      get realm_dart_object_slab_promote =>
+          _library._realm_dart_object_slab_promotePtr;
   ffi.Pointer<ffi.NativeFunction<ffi.Pointer<ffi.Void> Function(ffi.Handle)>>
       get realm_dart_object_to_persistent_handle =>
           _library._realm_dart_object_to_persistent_handlePtr;
@@ -11855,16 +12852,42 @@ class _SymbolAddresses {
                   ffi.Pointer<realm_app_error_t>)>>
       get realm_dart_return_string_callback =>
           _library._realm_dart_return_string_callbackPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Pointer<realm_scheduler_t> Function(
+                  ffi.Pointer<ffi.Void>, ffi.Int32)>>
+      get realm_dart_scheduler_create_lane =>
+          _library._realm_dart_scheduler_create_lanePtr;
+  ffi.Pointer<
+          ffi
+          .NativeFunction<ffi.Size Function(ffi.Pointer<ffi.Void>, ffi.Int32)>>
+      get realm_dart_scheduler_get_lane_depth =>
+          _library._realm_dart_scheduler_get_lane_depthPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(ffi.Pointer<ffi.Void>,
+                  ffi.Pointer<realm_dart_scheduler_stats_t>)>>
+      get realm_dart_scheduler_get_stats =>
+          _library._realm_dart_scheduler_get_statsPtr;
   ffi.Pointer<
           ffi
           .NativeFunction<ffi.Void Function(ffi.Uint64, ffi.Pointer<ffi.Void>)>>
       get realm_dart_scheduler_invoke =>
           _library._realm_dart_scheduler_invokePtr;
+  ffi.Pointer<
+          ffi
+          .NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>, ffi.Int64)>>
+      get realm_dart_scheduler_set_drain_budget =>
+          _library._realm_dart_scheduler_set_drain_budgetPtr;
   ffi.Pointer<
           ffi
           .NativeFunction<ffi.Bool Function(ffi.Long, ffi.Pointer<ffi.Long>)>>
       get realm_dart_set_and_get_rlimit =>
           _library._realm_dart_set_and_get_rlimitPtr;
+  ffi.Pointer<
+          ffi.NativeFunction<
+              ffi.Void Function(Dart_Port, ffi.Pointer<ffi.Char>, ffi.Int32)>>
+      get realm_dart_set_log_filter => _library._realm_dart_set_log_filterPtr;
   ffi.Pointer<
       ffi.NativeFunction<
           ffi.Bool Function(
@@ -11900,12 +12923,28 @@ class _SymbolAddresses {
                   ffi.Pointer<ffi.Void>, ffi.Uint64, ffi.Uint64, ffi.Double)>>
       get realm_dart_sync_progress_callback =>
           _library._realm_dart_sync_progress_callbackPtr;
+  ffi.Pointer<ffi.NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>)>>
+      get realm_dart_sync_progress_userdata_free =>
+          _library._realm_dart_sync_progress_userdata_freePtr;
+  ffi.Pointer<
+      ffi.NativeFunction<
+          realm_dart_userdata_async_t Function(
+              ffi.Handle,
+              ffi.Pointer<ffi.Void>,
+              ffi.Pointer<realm_scheduler_t>,
+              ffi.Uint64)>> get realm_dart_sync_progress_userdata_new =>
+      _library._realm_dart_sync_progress_userdata_newPtr;
   ffi.Pointer<
           ffi.NativeFunction<
               ffi.Void Function(
                   ffi.Pointer<ffi.Void>, ffi.Pointer<realm_error_t>)>>
       get realm_dart_sync_wait_for_completion_callback =>
           _library._realm_dart_sync_wait_for_completion_callbackPtr;
+  ffi.Pointer<
+          ffi
+          .NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>, ffi.Handle)>>
+      get realm_dart_update_finalizer_size =>
+          _library._realm_dart_update_finalizer_sizePtr;
   ffi.Pointer<
           ffi
           .NativeFunction<ffi.Void Function(ffi.Pointer<ffi.Void>, ffi.Int32)>>
@@ -12200,6 +13239,231 @@ final class realm_config extends ffi.Opaque {}
 /// Config types
 typedef realm_config_t = realm_config;
 
+final class realm_dart_child_registry extends ffi.Opaque {}
+
+typedef realm_dart_child_registry_t = realm_dart_child_registry;
+
+final class realm_dart_client_reset_metrics extends ffi.Struct {
+  /// the number of client reset callbacks invoked
+  @ffi.Uint64()
+  external int count;
+
+  /// the number of callbacks that did not complete within the timeout
+  @ffi.Uint64()
+  external int timeout_count;
+
+  /// the number of callbacks abandoned before they completed, because the handler was released first
+  @ffi.Uint64()
+  external int cancelled_count;
+
+  /// the time sync threads spent waiting for callbacks, in total and the longest single wait
+  @ffi.Uint64()
+  external int total_wait_us;
+
+  @ffi.Uint64()
+  external int max_wait_us;
+
+  /// the number of sync threads currently waiting for a callback
+  @ffi.Uint32()
+  external int in_flight;
+}
+
+typedef realm_dart_client_reset_metrics_t = realm_dart_client_reset_metrics;
+
+abstract class realm_dart_decimal128_op {
+  static const int RLM_DART_DECIMAL128_OP_ADD = 0;
+  static const int RLM_DART_DECIMAL128_OP_SUBTRACT = 1;
+  static const int RLM_DART_DECIMAL128_OP_MULTIPLY = 2;
+  static const int RLM_DART_DECIMAL128_OP_DIVIDE = 3;
+}
+
+abstract class realm_dart_decimal128_reduction {
+  static const int RLM_DART_DECIMAL128_REDUCTION_SUM = 0;
+  static const int RLM_DART_DECIMAL128_REDUCTION_MIN = 1;
+  static const int RLM_DART_DECIMAL128_REDUCTION_MAX = 2;
+  static const int RLM_DART_DECIMAL128_REDUCTION_AVERAGE = 3;
+}
+
+final class realm_dart_handle_stats extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> type_name;
+
+  /// the number of handles of the type alive, and the native bytes they hold
+  @ffi.Uint64()
+  external int live_count;
+
+  @ffi.Uint64()
+  external int live_bytes;
+
+  /// the number of handles of the type created since the process started, and of those whose native object
+  /// was released by their GC finalizer, rather than explicitly or with their realm or scope
+  @ffi.Uint64()
+  external int created_count;
+
+  @ffi.Uint64()
+  external int finalized_count;
+
+  /// the number of handles released with their realm or scope, whose finalizers are yet to run
+  @ffi.Uint64()
+  external int pending_finalizer_count;
+}
+
+typedef realm_dart_handle_stats_t = realm_dart_handle_stats;
+
+/// The kinds of native objects held by Dart handles, for accounting of their memory
+abstract class realm_dart_handle_type {
+  static const int RLM_DART_HANDLE_TYPE_OTHER = 0;
+  static const int RLM_DART_HANDLE_TYPE_REALM = 1;
+  static const int RLM_DART_HANDLE_TYPE_OBJECT = 2;
+  static const int RLM_DART_HANDLE_TYPE_OBJECT_SLAB = 3;
+  static const int RLM_DART_HANDLE_TYPE_RESULTS = 4;
+  static const int RLM_DART_HANDLE_TYPE_LIST = 5;
+  static const int RLM_DART_HANDLE_TYPE_SET = 6;
+  static const int RLM_DART_HANDLE_TYPE_DICTIONARY = 7;
+  static const int RLM_DART_HANDLE_TYPE_QUERY = 8;
+  static const int RLM_DART_HANDLE_TYPE_CHANGES = 9;
+  static const int RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN = 10;
+  static const int RLM_DART_HANDLE_TYPE_CONFIG = 11;
+  static const int RLM_DART_HANDLE_TYPE_SCHEMA = 12;
+  static const int RLM_DART_HANDLE_TYPE_SCHEDULER = 13;
+  static const int RLM_DART_HANDLE_TYPE_APP = 14;
+  static const int RLM_DART_HANDLE_TYPE_USER = 15;
+  static const int RLM_DART_HANDLE_TYPE_CREDENTIALS = 16;
+  static const int RLM_DART_HANDLE_TYPE_SESSION = 17;
+  static const int RLM_DART_HANDLE_TYPE_SUBSCRIPTION = 18;
+  static const int RLM_DART_HANDLE_TYPE_ASYNC_OPEN_TASK = 19;
+  static const int RLM_DART_HANDLE_TYPE_HTTP_TRANSPORT = 20;
+  static const int RLM_DART_HANDLE_TYPE_COUNT = 21;
+}
+
+final class realm_dart_http_endpoint_metrics extends ffi.Struct {
+  /// the method and the route of the requests: their path without the query, with segments that look like ids,
+  /// such as ObjectIds, UUIDs and numbers, replaced by {id}. Requests beyond the first 256 routes share the route {other}.
+  @ffi.Int32()
+  external int method;
+
+  external ffi.Pointer<ffi.Char> path;
+
+  /// the number of requests that completed, timed out or failed, and the number still running
+  @ffi.Uint64()
+  external int request_count;
+
+  @ffi.Uint32()
+  external int in_flight;
+
+  @ffi.Uint64()
+  external int timeout_count;
+
+  @ffi.Uint64()
+  external int socket_error_count;
+
+  @ffi.Uint64()
+  external int error_count;
+
+  /// the size of the request and response bodies
+  @ffi.Uint64()
+  external int bytes_sent;
+
+  @ffi.Uint64()
+  external int bytes_received;
+
+  /// time from the transport receiving a request until it starts executing it. For the Dart transport
+  /// this is the time waiting for the isolate. Percentiles are rounded up to the next power of two.
+  @ffi.Uint64()
+  external int queue_p50_us;
+
+  @ffi.Uint64()
+  external int queue_p99_us;
+
+  @ffi.Uint64()
+  external int queue_max_us;
+
+  /// time from the transport receiving a request until the response headers are received
+  @ffi.Uint64()
+  external int first_byte_p50_us;
+
+  @ffi.Uint64()
+  external int first_byte_p99_us;
+
+  @ffi.Uint64()
+  external int first_byte_max_us;
+
+  /// time from the transport receiving a request until the whole response is received
+  @ffi.Uint64()
+  external int latency_p50_us;
+
+  @ffi.Uint64()
+  external int latency_p99_us;
+
+  @ffi.Uint64()
+  external int latency_max_us;
+}
+
+typedef realm_dart_http_endpoint_metrics_t = realm_dart_http_endpoint_metrics;
+
+final class realm_dart_http_metrics extends ffi.Opaque {}
+
+typedef realm_dart_http_metrics_t = realm_dart_http_metrics;
+
+abstract class realm_dart_http_outcome {
+  /// a response was received, whatever its status code
+  static const int RLM_DART_HTTP_OUTCOME_COMPLETED = 0;
+  static const int RLM_DART_HTTP_OUTCOME_TIMEOUT = 1;
+  static const int RLM_DART_HTTP_OUTCOME_SOCKET_ERROR = 2;
+  static const int RLM_DART_HTTP_OUTCOME_ERROR = 3;
+}
+
+final class realm_dart_object_slab extends ffi.Opaque {}
+
+typedef realm_dart_object_slab_t = realm_dart_object_slab;
+
+/// Lanes of work delivered on the isolate, in order of priority.
+abstract class realm_dart_scheduler_lane {
+  /// collection, object and realm change notifications
+  static const int RLM_DART_SCHEDULER_LANE_NOTIFICATIONS = 0;
+
+  /// sync and app callbacks, such as progress, connection state and completion handlers
+  static const int RLM_DART_SCHEDULER_LANE_CALLBACKS = 1;
+  static const int RLM_DART_SCHEDULER_LANE_COUNT = 2;
+}
+
+final class realm_dart_scheduler_stats extends ffi.Struct {
+  /// number of times core asked the scheduler to run a work queue
+  @ffi.Uint64()
+  external int notify_count;
+
+  /// number of wake-up messages actually posted to the Dart port, including re-posts of deferred work
+  @ffi.Uint64()
+  external int post_count;
+
+  /// number of notifications that piggybacked on an already pending wake-up
+  @ffi.Uint64()
+  external int coalesced_count;
+
+  /// number of work queues run on the isolate
+  @ffi.Uint64()
+  external int drained_count;
+
+  /// number of times a work queue was pushed to a later wake-up because the drain budget ran out
+  @ffi.Uint64()
+  external int deferred_count;
+
+  /// number of wake-ups handled on the isolate
+  @ffi.Uint64()
+  external int invoke_count;
+
+  /// time from core notifying the scheduler until the work starts running on the isolate,
+  /// measured with a monotonic clock. Percentiles are rounded up to the next power of two.
+  @ffi.Uint64()
+  external int latency_p50_us;
+
+  @ffi.Uint64()
+  external int latency_p99_us;
+
+  @ffi.Uint64()
+  external int latency_max_us;
+}
+
+typedef realm_dart_scheduler_stats_t = realm_dart_scheduler_stats;
 final class realm_dart_userdata_async extends ffi.Opaque {}
 
 typedef realm_dart_userdata_async_t = ffi.Pointer<realm_dart_userdata_async>;
@@ -13437,3 +14701,5 @@ final class realm_work_queue extends ffi.Opaque {}
 typedef realm_work_queue_t = realm_work_queue;
 
 final class shared_realm extends ffi.Opaque {}
+
+const int RLM_DART_DECIMAL128_STRING_BUFFER_SIZE = 48;
@@ -13,6 +13,8 @@ import 'package:realm_dart/realm.dart';
 import 'convert_native.dart';
 import 'error_handling.dart';
 import 'ffi.dart';
+import 'handle_base.dart';
+import 'realm_bindings.dart';
 import 'realm_library.dart';
 import 'scheduler_handle.dart';
 
@@ -176,6 +178,82 @@ class RealmCore implements intf.RealmCore {
   @override
   void loggerDetach() => realmLib.realm_dart_detach_logger(schedulerHandle.sendPort.nativePort);
 
+  @override
+  int get loggerDroppedCount => realmLib.realm_dart_logger_get_dropped_count();
+
+  @override
+  ClientResetMetrics get clientResetMetrics {
+    return using((arena) {
+      final metrics = arena<realm_dart_client_reset_metrics_t>();
+      realmLib.realm_dart_client_reset_get_metrics(metrics);
+      return ClientResetMetrics(
+        count: metrics.ref.count,
+        timeoutCount: metrics.ref.timeout_count,
+        cancelledCount: metrics.ref.cancelled_count,
+        totalWait: Duration(microseconds: metrics.ref.total_wait_us),
+        maxWait: Duration(microseconds: metrics.ref.max_wait_us),
+        inFlight: metrics.ref.in_flight,
+      );
+    });
+  }
+
+  @override
+  Map<String, intf.NativeHandleStats> get nativeHandleStats {
+    return using((arena) {
+      final stats = arena<realm_dart_handle_stats_t>(realm_dart_handle_type.RLM_DART_HANDLE_TYPE_COUNT);
+      realmLib.realm_dart_get_handle_stats(stats);
+      return {
+        for (var i = 0; i < realm_dart_handle_type.RLM_DART_HANDLE_TYPE_COUNT; i++)
+          (stats + i).ref.type_name.cast<Utf8>().toDartString(): (
+            liveCount: (stats + i).ref.live_count,
+            liveBytes: (stats + i).ref.live_bytes,
+            createdCount: (stats + i).ref.created_count,
+            finalizedCount: (stats + i).ref.finalized_count,
+            pendingFinalizerCount: (stats + i).ref.pending_finalizer_count,
+          ),
+      };
+    });
+  }
+
+  @override
+  int get handleSampleInterval => HandleSampler.interval;
+
+  @override
+  set handleSampleInterval(int value) => HandleSampler.interval = value;
+
+  @override
+  List<intf.HandleAllocationSample> get handleAllocationSamples {
+    return using((arena) {
+      // the stats are indexed by the realm_dart_handle_type of the samples
+      final stats = arena<realm_dart_handle_stats_t>(realm_dart_handle_type.RLM_DART_HANDLE_TYPE_COUNT);
+      realmLib.realm_dart_get_handle_stats(stats);
+      return [
+        for (final sample in HandleSampler.liveSamples)
+          (type: (stats + sample.type).ref.type_name.cast<Utf8>().toDartString(), createdAt: sample.createdAt, stackTrace: sample.stackTrace),
+      ];
+    });
+  }
+
+  @override
+  void attachFileLogSink(String path, {required int maxFileSize, required int maxFileCount, required Map<LogCategory, LogLevel> levels}) {
+    using((arena) {
+      final categories = arena<Pointer<Char>>(levels.length);
+      final levelValues = arena<Int32>(levels.length);
+      var i = 0;
+      for (final MapEntry(key: category, value: level) in levels.entries) {
+        categories[i] = category.toString().toCharPtr(arena);
+        levelValues[i] = level.index;
+        i++;
+      }
+      realmLib
+          .realm_dart_attach_file_log_sink(path.toCharPtr(arena), maxFileSize, maxFileCount, categories, levelValues, levels.length)
+          .raiseLastErrorIfFalse();
+    });
+  }
+
+  @override
+  void detachFileLogSink() => realmLib.realm_dart_detach_file_log_sink();
+
   @override
   void logMessage(LogCategory category, LogLevel logLevel, String message) {
     return using((arena) {
@@ -186,7 +264,7 @@ class RealmCore implements intf.RealmCore {
   @override
   void setLogLevel(LogLevel level, {required LogCategory category}) {
     using((arena) {
-      realmLib.realm_set_log_level_category(category.toString().toCharPtr(arena), level.index);
+      realmLib.realm_dart_set_log_filter(schedulerHandle.sendPort.nativePort, category.toString().toCharPtr(arena), level.index);
     });
   }
 
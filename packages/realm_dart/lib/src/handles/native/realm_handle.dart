@@ -29,11 +29,13 @@ import 'subscription_set_handle.dart';
 import '../realm_handle.dart' as intf;
 
 class RealmHandle extends HandleBase<shared_realm> implements intf.RealmHandle {
-  int _counter = 0;
+  // The children to release with this handle are registered natively, created on first use.
+  ChildRegistryHandle? _registry;
 
-  final Map<int, WeakReference<RootedHandleBase>> _children = {};
+  // The levels children are added at, the realm itself first and the innermost open scope last.
+  final List<ChildLevel> _levels = [ChildLevel(0)];
 
-  RealmHandle(Pointer<shared_realm> pointer) : super(pointer, 24);
+  RealmHandle(Pointer<shared_realm> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_REALM);
 
   RealmHandle.unowned(super.pointer) : super.unowned();
 
@@ -50,29 +52,54 @@ class RealmHandle extends HandleBase<shared_realm> implements intf.RealmHandle {
         .raiseLastErrorIfNull());
   }
 
+  /// Registers [child] to be released with this handle, or with the innermost open scope
+  /// if it is scoped. Returns the level it was added at.
+  ChildLevel addChild(RootedHandleBase child) {
+    final level = child.isScoped ? _levels.last : _levels.first;
+    (_registry ??= ChildRegistryHandle()).add(child, level);
+    return level;
+  }
+
+  bool get inScope => _levels.length > 1;
+
   @override
-  int addChild(covariant RootedHandleBase child) {
-    final id = _counter++;
-    _children[id] = WeakReference(child);
-    rootedHandleFinalizer.attach(this, FinalizationToken(this, id), detach: this);
-    return id;
+  void beginScope() => _levels.add(ChildLevel(_levels.length));
+
+  @override
+  void endScope() {
+    assert(inScope, 'No scope to end');
+    final level = _levels.removeLast()..released = true;
+    _registry?.releaseChildren(level);
   }
 
   @override
-  void removeChild(int id) {
-    final child = _children.remove(id);
-    if (child != null) {
-      final target = child.target;
-      if (target != null) {
-        rootedHandleFinalizer.detach(target);
-      }
+  void escape(covariant RootedHandleBase handle) => handle.escape();
+
+  /// Moves [child] out of [level], into the enclosing scope if any. Returns its new level,
+  /// or null if it is no longer released with this handle.
+  ChildLevel? escapeChild(RootedHandleBase child, ChildLevel level) {
+    if (level.depth == 0) {
+      return level;
+    }
+    final outer = _levels[level.depth - 1];
+    if (outer.depth == 0 && !child.shouldRoot) {
+      _registry!.remove(child);
+      return null;
     }
+    _registry!.move(child, outer);
+    return outer;
   }
 
   @override
   void releaseCore() {
-    for (final child in _children.values.toList()) {
-      child.target?.release();
+    for (final level in _levels) {
+      level.released = true;
+    }
+    final registry = _registry;
+    if (registry != null) {
+      registry.releaseChildren(_levels.first);
+      registry.release();
+      _registry = null;
     }
   }
 
@@ -504,7 +531,11 @@ class RealmHandle extends HandleBase<shared_realm> implements intf.RealmHandle {
 }
 
 class CallbackTokenHandle extends RootedHandleBase<realm_callback_token> implements intf.CallbackTokenHandle {
-  CallbackTokenHandle(Pointer<realm_callback_token> pointer, RealmHandle root) : super(root, pointer, 32);
+  CallbackTokenHandle(Pointer<realm_callback_token> pointer, RealmHandle root)
+      : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN);
+
+  @override
+  bool get isScoped => false;
 }
 
 void _schemaChangeCallback(Pointer<Void> userdata, Pointer<realm_schema> data) {
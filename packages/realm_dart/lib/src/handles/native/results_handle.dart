@@ -10,6 +10,7 @@ import 'convert_native.dart';
 import 'error_handling.dart';
 import 'notification_token_handle.dart';
 import 'object_handle.dart';
+import 'object_slab_handle.dart';
 import 'query_handle.dart';
 import 'realm_bindings.dart';
 import 'realm_handle.dart';
@@ -19,7 +20,7 @@ import 'rooted_handle.dart';
 import '../results_handle.dart' as intf;
 
 class ResultsHandle extends RootedHandleBase<realm_results> implements intf.ResultsHandle {
-  ResultsHandle(Pointer<realm_results> pointer, RealmHandle root) : super(root, pointer, 872);
+  ResultsHandle(Pointer<realm_results> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_RESULTS);
 
   @override
   ResultsHandle queryResults(String query, List<Object> args) {
@@ -67,13 +68,27 @@ class ResultsHandle extends RootedHandleBase<realm_results> implements intf.Resu
     return ObjectHandle(realmLib.realm_results_get_object(pointer, index), root);
   }
 
+  @override
+  ObjectSlabHandle createObjectSlab() => ObjectSlabHandle(root);
+
+  @override
+  ObjectHandle borrowObjectAt(covariant ObjectSlabHandle slab, int index) => slab.borrowResultsObject(this, index);
+
+  int _measuredCount = -1;
+
   @override
   int get count {
-    return using((arena) {
+    final count = using((arena) {
       final countPtr = arena<Size>();
       realmLib.realm_results_count(pointer, countPtr).raiseLastErrorIfFalse();
       return countPtr.value;
     });
+    // counting evaluates the results, so report the rows they now hold to the GC
+    if (count != _measuredCount) {
+      _measuredCount = count;
+      updateNativeSize();
+    }
+    return count;
   }
 
   @override
@@ -113,6 +128,27 @@ class ResultsHandle extends RootedHandleBase<realm_results> implements intf.Resu
     });
   }
 
+  @override
+  Object? sum(int propertyKey) => _aggregate(realmLib.realm_results_sum, propertyKey);
+
+  @override
+  Object? min(int propertyKey) => _aggregate(realmLib.realm_results_min, propertyKey);
+
+  @override
+  Object? max(int propertyKey) => _aggregate(realmLib.realm_results_max, propertyKey);
+
+  @override
+  Object? average(int propertyKey) => _aggregate(realmLib.realm_results_average, propertyKey);
+
+  Object? _aggregate(bool Function(Pointer<realm_results>, int, Pointer<realm_value_t>, Pointer<Bool>) aggregate, int propertyKey) {
+    return using((arena) {
+      final outValue = arena<realm_value_t>();
+      final outFound = arena<Bool>();
+      aggregate(pointer, propertyKey, outValue, outFound).raiseLastErrorIfFalse();
+      return outFound.value ? outValue.ref.toPrimitiveValue() : null;
+    });
+  }
+
   @override
   NotificationTokenHandle subscribeForNotifications(NotificationsController controller, List<String>? keyPaths, int? classKey) {
     return using((Arena arena) {
@@ -4,38 +4,75 @@
 import 'dart:ffi';
 
 import 'handle_base.dart';
+import 'realm_bindings.dart';
 import 'realm_handle.dart';
+import 'realm_library.dart';
 
-class FinalizationToken {
-  final WeakReference<RealmHandle> root;
-  final int id;
+/// A level of the children of a [RealmHandle], 0 for the realm itself and one more for
+/// each open scope. Its children are released natively in bulk, so they check their level
+/// to know whether they are released.
+class ChildLevel {
+  final int depth;
+  bool released = false;
 
-  FinalizationToken(RealmHandle handle, this.id) : root = WeakReference(handle);
+  ChildLevel(this.depth);
 }
 
-// This finalizer is intended to prevent the list of children in the RealmHandle
-// from growing endlessly. It's not intended to replace the native finalizer which
-// will free the actual resources owned by the handle.
-final rootedHandleFinalizer = Finalizer<FinalizationToken>((token) {
-  token.root.target?.removeChild(token.id);
-});
+/// The native registry of the children of a [RealmHandle]. Registering a child costs
+/// no Dart allocation, and releasing all the children of a level is a single call.
+class ChildRegistryHandle extends HandleBase<realm_dart_child_registry> {
+  ChildRegistryHandle() : super(realmLib.realm_dart_child_registry_new(), realm_dart_handle_type.RLM_DART_HANDLE_TYPE_OTHER);
+
+  void add(HandleBase child, ChildLevel level) => realmLib.realm_dart_child_registry_add(pointer, child.finalizer, level.depth);
+
+  void move(HandleBase child, ChildLevel level) => realmLib.realm_dart_child_registry_move(pointer, child.finalizer, level.depth);
+
+  void remove(HandleBase child) => realmLib.realm_dart_child_registry_remove(child.finalizer);
+
+  void releaseChildren(ChildLevel level) => realmLib.realm_dart_child_registry_release(pointer, level.depth);
+}
 
 abstract class RootedHandleBase<T extends NativeType> extends HandleBase<T> {
   final RealmHandle root;
-  int? _id;
+  ChildLevel? _level;
 
   bool get shouldRoot => root.isUnowned;
 
-  RootedHandleBase(this.root, Pointer<T> pointer, int size) : super(pointer, size) {
-    if (shouldRoot) {
-      _id = root.addChild(this);
-    }
+  /// Whether the handle is released when a scope it is created in ends. Handles that
+  /// keep a registration alive, such as notification tokens, are not.
+  bool get isScoped => true;
+
+  RootedHandleBase(this.root, Pointer<T> pointer, int type) : super(pointer, type) {
+    _addToRoot();
   }
 
+  // Borrowed handles are released with their lender, and only rooted once promoted.
+  RootedHandleBase.borrowed(this.root, Pointer<T> pointer, HandleLender<T> lender, int slot, int type) : super.borrowed(pointer, lender, slot, type);
+
   @override
-  void releaseCore() {
-    if (_id != null) {
-      root.removeChild(_id!);
+  bool get released => super.released || (_level?.released ?? false);
+
+  @override
+  bool get releasedByScope {
+    final level = _level;
+    return (level != null && level.depth > 0 && level.released && !root.released) || super.releasedByScope;
+  }
+
+  @override
+  void onPromoted() => _addToRoot();
+
+  void _addToRoot() {
+    if (shouldRoot || (isScoped && root.inScope)) {
+      _level = root.addChild(this);
+    }
+  }
+
+  /// Keeps the handle alive past the end of the scope it was created in.
+  void escape() {
+    ensureOwned();
+    final level = _level;
+    if (level != null && !released) {
+      _level = root.escapeChild(this, level);
     }
   }
 }
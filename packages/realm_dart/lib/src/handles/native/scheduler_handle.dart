@@ -5,6 +5,7 @@ import 'dart:ffi';
 import 'dart:isolate';
 
 import '../../scheduler.dart';
+import 'ffi.dart';
 import 'handle_base.dart';
 import 'realm_bindings.dart';
 import 'realm_library.dart';
@@ -12,19 +13,81 @@ import 'realm_library.dart';
 import '../scheduler_handle.dart' as intf;
 
 class SchedulerHandle extends HandleBase<realm_scheduler> implements intf.SchedulerHandle {
+  final int isolateId;
   final SendPort sendPort;
-  SchedulerHandle._(this.sendPort, Pointer<realm_scheduler> pointer) : super(pointer, 24);
+
+  // Owned by the native scheduler, hence valid as long as this handle is.
+  final Pointer<Void> _schedulerData;
+
+  // Scheduler for sync and app callbacks. It shares wake-ups with this one, but its
+  // work is always run after pending notifications.
+  final _SchedulerLaneHandle _callbacks;
+
+  Pointer<realm_scheduler> get callbacksPointer => _callbacks.pointer;
+
+  // Scheduler running on the native event loop, for realms never accessed from Dart.
+  _SchedulerLaneHandle? _eventLoop;
+
+  Pointer<realm_scheduler> get eventLoopPointer => (_eventLoop ??= _SchedulerLaneHandle(realmLib.realm_dart_create_event_loop_scheduler())).pointer;
+
+  SchedulerHandle._(this.isolateId, this.sendPort, this._schedulerData, Pointer<realm_scheduler> pointer)
+      : _callbacks = _SchedulerLaneHandle(realmLib.realm_dart_scheduler_create_lane(_schedulerData, realm_dart_scheduler_lane.RLM_DART_SCHEDULER_LANE_CALLBACKS)),
+        super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SCHEDULER);
 
   factory SchedulerHandle(int isolateId, SendPort sendPort) {
-    final schedulerPtr = realmLib.realm_dart_create_scheduler(isolateId, sendPort.nativePort);
-    return SchedulerHandle._(sendPort, schedulerPtr);
+    return using((arena) {
+      final outSchedulerData = arena<Pointer<Void>>();
+      final schedulerPtr = realmLib.realm_dart_create_scheduler(isolateId, sendPort.nativePort, outSchedulerData);
+      return SchedulerHandle._(isolateId, sendPort, outSchedulerData.value, schedulerPtr);
+    });
   }
 
   @override
-  void invoke(int workQueue) {
-    final queuePointer = Pointer<realm_work_queue>.fromAddress(workQueue);
-    realmLib.realm_scheduler_perform_work(queuePointer);
+  void invoke(int schedulerData) {
+    assert(schedulerData == _schedulerData.address);
+    realmLib.realm_dart_scheduler_invoke(isolateId, _schedulerData);
   }
+
+  @override
+  intf.SchedulerStats get stats {
+    return using((arena) {
+      final outStats = arena<realm_dart_scheduler_stats_t>();
+      realmLib.realm_dart_scheduler_get_stats(_schedulerData, outStats);
+      final stats = outStats.ref;
+      return (
+        notifyCount: stats.notify_count,
+        postCount: stats.post_count,
+        coalescedCount: stats.coalesced_count,
+        invokeCount: stats.invoke_count,
+        drainedCount: stats.drained_count,
+        deferredCount: stats.deferred_count,
+        latencyP50: Duration(microseconds: stats.latency_p50_us),
+        latencyP99: Duration(microseconds: stats.latency_p99_us),
+        latencyMax: Duration(microseconds: stats.latency_max_us),
+      );
+    });
+  }
+
+  @override
+  intf.SchedulerLaneDepths get laneDepths => (
+        notifications: realmLib.realm_dart_scheduler_get_lane_depth(_schedulerData, realm_dart_scheduler_lane.RLM_DART_SCHEDULER_LANE_NOTIFICATIONS),
+        callbacks: realmLib.realm_dart_scheduler_get_lane_depth(_schedulerData, realm_dart_scheduler_lane.RLM_DART_SCHEDULER_LANE_CALLBACKS),
+      );
+
+  @override
+  void releaseCore() {
+    _callbacks.release();
+    _eventLoop?.release();
+  }
+
+  @override
+  void setDrainBudget(Duration? budget) {
+    realmLib.realm_dart_scheduler_set_drain_budget(_schedulerData, budget?.inMicroseconds ?? 0);
+  }
+}
+
+class _SchedulerLaneHandle extends HandleBase<realm_scheduler> {
+  _SchedulerLaneHandle(Pointer<realm_scheduler> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SCHEDULER);
 }
 
 final schedulerHandle = scheduler.handle as SchedulerHandle;
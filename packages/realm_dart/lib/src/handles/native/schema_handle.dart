@@ -15,7 +15,7 @@ import 'to_native.dart';
 import '../schema_handle.dart' as intf;
 
 class SchemaHandle extends HandleBase<realm_schema> implements intf.SchemaHandle {
-  SchemaHandle(Pointer<realm_schema> pointer) : super(pointer, 24);
+  SchemaHandle(Pointer<realm_schema> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SCHEMA);
 
   SchemaHandle.unowned(super.pointer) : super.unowned();
 
@@ -22,7 +22,10 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
   @override
   bool get shouldRoot => true;
 
-  SessionHandle(Pointer<realm_sync_session_t> pointer, RealmHandle root) : super(root, pointer, 24);
+  @override
+  bool get isScoped => false;
+
+  SessionHandle(Pointer<realm_sync_session_t> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SESSION);
 
   @override
   String get path {
@@ -83,7 +86,7 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
     final completer = CancellableCompleter<void>(cancellationToken);
     if (!completer.isCancelled) {
       final callback = Pointer.fromFunction<Void Function(Handle, Pointer<realm_error_t>)>(_waitCompletionCallback);
-      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.pointer);
+      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.callbacksPointer);
       realmLib.realm_sync_session_wait_for_upload_completion(
         pointer,
         realmLib.addresses.realm_dart_sync_wait_for_completion_callback,
@@ -99,7 +102,7 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
     final completer = CancellableCompleter<void>(cancellationToken);
     if (!completer.isCancelled) {
       final callback = Pointer.fromFunction<Void Function(Handle, Pointer<realm_error_t>)>(_waitCompletionCallback);
-      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.pointer);
+      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.callbacksPointer);
       realmLib.realm_sync_session_wait_for_download_completion(
         pointer,
         realmLib.addresses.realm_dart_sync_wait_for_completion_callback,
@@ -126,7 +129,7 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
   @override
   SyncSessionNotificationTokenHandle subscribeForConnectionStateNotifications(SessionConnectionStateController controller) {
     final callback = Pointer.fromFunction<Void Function(Handle, Int32, Int32)>(_onConnectionStateChange);
-    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.pointer);
+    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.callbacksPointer);
     return SyncSessionNotificationTokenHandle(
       realmLib.realm_sync_session_register_connection_state_change_callback(
         pointer,
@@ -141,11 +144,12 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
   SyncSessionNotificationTokenHandle subscribeForProgressNotifications(
     ProgressDirection direction,
     ProgressMode mode,
+    Duration interval,
     SessionProgressNotificationsController controller,
   ) {
     final isStreaming = mode == ProgressMode.reportIndefinitely;
     final callback = Pointer.fromFunction<Void Function(Handle, Uint64, Uint64, Double)>(syncProgressCallback);
-    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.pointer);
+    final userdata = realmLib.realm_dart_sync_progress_userdata_new(controller, callback.cast(), schedulerHandle.callbacksPointer, interval.inMilliseconds);
     return SyncSessionNotificationTokenHandle(
       realmLib.realm_sync_session_register_progress_notifier(
         pointer,
@@ -153,7 +157,7 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
         direction.index,
         isStreaming,
         userdata.cast(),
-        realmLib.addresses.realm_dart_userdata_async_free,
+        realmLib.addresses.realm_dart_sync_progress_userdata_free,
       ),
     );
   }
@@ -161,7 +165,8 @@ class SessionHandle extends RootedHandleBase<realm_sync_session_t> implements in
 
 class SyncSessionNotificationTokenHandle extends HandleBase<realm_sync_session_connection_state_notification_token>
     implements intf.SyncSessionNotificationTokenHandle {
-  SyncSessionNotificationTokenHandle(Pointer<realm_sync_session_connection_state_notification_token> pointer) : super(pointer, 32);
+  SyncSessionNotificationTokenHandle(Pointer<realm_sync_session_connection_state_notification_token> pointer)
+      : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN);
 }
 
 void _onConnectionStateChange(Object userdata, int oldState, int newState) {
@@ -19,7 +19,7 @@ import 'rooted_handle.dart';
 import '../set_handle.dart' as intf;
 
 class SetHandle extends RootedHandleBase<realm_set> implements intf.SetHandle {
-  SetHandle(Pointer<realm_set> pointer, RealmHandle root) : super(root, pointer, 96);
+  SetHandle(Pointer<realm_set> pointer, RealmHandle root) : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SET);
 
   @override
   ResultsHandle get asResults {
@@ -11,7 +11,7 @@ import 'realm_library.dart';
 
 import '../subscription_handle.dart' as intf;
 class SubscriptionHandle extends HandleBase<realm_flx_sync_subscription> implements intf.SubscriptionHandle{
-  SubscriptionHandle(Pointer<realm_flx_sync_subscription> pointer) : super(pointer, 184);
+  SubscriptionHandle(Pointer<realm_flx_sync_subscription> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SUBSCRIPTION);
 
   @override
   ObjectId get id => realmLib.realm_sync_subscription_id(pointer).toDart();
@@ -23,7 +23,11 @@ class SubscriptionSetHandle extends RootedHandleBase<realm_flx_sync_subscription
   @override
   bool get shouldRoot => true;
 
-  SubscriptionSetHandle(Pointer<realm_flx_sync_subscription_set> pointer, RealmHandle root) : super(root, pointer, 128);
+  @override
+  bool get isScoped => false;
+
+  SubscriptionSetHandle(Pointer<realm_flx_sync_subscription_set> pointer, RealmHandle root)
+      : super(root, pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_SUBSCRIPTION);
 
   @override
   void refresh() => realmLib.realm_sync_subscription_set_refresh(pointer).raiseLastErrorIfFalse();
@@ -82,7 +86,7 @@ class SubscriptionSetHandle extends RootedHandleBase<realm_flx_sync_subscription
     final completer = CancellableCompleter<SubscriptionSetState>(cancellationToken);
     if (!completer.isCancelled) {
       final callback = Pointer.fromFunction<Void Function(Handle, Int32)>(_stateChangeCallback);
-      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.pointer);
+      final userdata = realmLib.realm_dart_userdata_async_new(completer, callback.cast(), schedulerHandle.callbacksPointer);
       realmLib.realm_sync_on_subscription_set_state_change_async(pointer, notifyWhen.index,
           realmLib.addresses.realm_dart_sync_on_subscription_state_changed_callback, userdata.cast(), realmLib.addresses.realm_dart_userdata_async_free);
     }
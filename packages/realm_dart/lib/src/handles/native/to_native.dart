@@ -152,7 +152,7 @@ void _intoRealmValue(Object? value, realm_value realmValue, Allocator allocator)
     realmValue.values.timestamp.nanoseconds = nanoseconds;
     realmValue.type = realm_value_type.RLM_TYPE_TIMESTAMP;
   } else if (value is Decimal128) {
-    realmValue.values.decimal128 = value.value;
+    value.copyTo(realmValue.values.decimal128);
     realmValue.type = realm_value_type.RLM_TYPE_DECIMAL128;
   } else if (value is Uint8List) {
     realmValue.type = realm_value_type.RLM_TYPE_BINARY;
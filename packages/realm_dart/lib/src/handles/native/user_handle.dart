@@ -22,7 +22,7 @@ import 'scheduler_handle.dart';
 import '../user_handle.dart' as intf;
 
 class UserHandle extends HandleBase<realm_user> implements intf.UserHandle {
-  UserHandle(Pointer<realm_user> pointer) : super(pointer, 24);
+  UserHandle(Pointer<realm_user> pointer) : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_USER);
 
   @override
   AppHandle get app {
@@ -258,7 +258,7 @@ class UserHandle extends HandleBase<realm_user> implements intf.UserHandle {
   @override
   UserNotificationTokenHandle subscribeForNotifications(UserNotificationsController controller) {
     final callback = Pointer.fromFunction<Void Function(Handle, Int32)>(_userChangeCallback);
-    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.pointer);
+    final userdata = realmLib.realm_dart_userdata_async_new(controller, callback.cast(), schedulerHandle.callbacksPointer);
     final notificationToken = realmLib.realm_sync_user_on_state_change_register_callback(
       pointer,
       realmLib.addresses.realm_dart_user_change_callback,
@@ -270,7 +270,8 @@ class UserHandle extends HandleBase<realm_user> implements intf.UserHandle {
 }
 
 class UserNotificationTokenHandle extends HandleBase<realm_app_user_subscription_token> implements intf.UserNotificationTokenHandle {
-  UserNotificationTokenHandle(Pointer<realm_app_user_subscription_token> pointer) : super(pointer, 32);
+  UserNotificationTokenHandle(Pointer<realm_app_user_subscription_token> pointer)
+      : super(pointer, realm_dart_handle_type.RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN);
 }
 
 void _userChangeCallback(Object userdata, int data) {
@@ -290,7 +291,7 @@ Pointer<Void> createAsyncUserCallbackUserdata(Completer<void> completer) {
   final userdata = realmLib.realm_dart_userdata_async_new(
     completer,
     callback.cast(),
-    schedulerHandle.pointer,
+    schedulerHandle.callbacksPointer,
   );
 
   return userdata.cast();
@@ -324,7 +325,7 @@ Pointer<Void> _createAsyncApikeyCallbackUserdata<T extends Function>(Completer<A
   final userdata = realmLib.realm_dart_userdata_async_new(
     completer,
     callback.cast(),
-    schedulerHandle.pointer,
+    schedulerHandle.callbacksPointer,
   );
 
   return userdata.cast();
@@ -351,7 +352,7 @@ Pointer<Void> _createAsyncApikeyListCallbackUserdata<T extends Function>(Complet
   final userdata = realmLib.realm_dart_userdata_async_new(
     completer,
     callback.cast(),
-    schedulerHandle.pointer,
+    schedulerHandle.callbacksPointer,
   );
 
   return userdata.cast();
@@ -0,0 +1,9 @@
+// Copyright 2024 MongoDB, Inc.
+// SPDX-License-Identifier: Apache-2.0
+
+import 'handle_base.dart';
+
+abstract interface class ObjectSlabHandle extends HandleBase {
+  bool get isFull;
+  void stopLending();
+}
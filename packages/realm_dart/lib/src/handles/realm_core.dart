@@ -5,6 +5,22 @@ import 'package:realm_dart/realm.dart';
 
 import 'native/realm_core.dart' if (dart.library.js_interop) 'web/realm_core.dart' as impl;
 
+/// The census of the handles of one type in the process.
+///
+/// * [liveCount] and [liveBytes] are the handles alive and the native bytes they hold. The bytes
+///   are those reported to the Dart garbage collector for the handles, measured by the native code.
+///   Data shared between handles, such as the database file, is not counted.
+/// * [createdCount] is the number of handles created since the process started, and
+///   [finalizedCount] the number of those whose native object was released by their garbage
+///   collector finalizer, rather than explicitly or with their realm or scope.
+/// * [pendingFinalizerCount] is the number of handles released with their realm or scope while
+///   still reachable from Dart, whose finalizers are yet to run.
+typedef NativeHandleStats = ({int liveCount, int liveBytes, int createdCount, int finalizedCount, int pendingFinalizerCount});
+
+/// Where a handle still holding its native object was created, as recorded while sampling
+/// allocations with [RealmDiagnostics.allocationSampleInterval].
+typedef HandleAllocationSample = ({String type, DateTime createdAt, StackTrace stackTrace});
+
 abstract interface class RealmCore {
   int get threadId;
 
@@ -20,7 +36,16 @@ abstract interface class RealmCore {
 
   void loggerAttach();
   void loggerDetach();
+  int get loggerDroppedCount;
+  void attachFileLogSink(String path, {required int maxFileSize, required int maxFileCount, required Map<LogCategory, LogLevel> levels});
+  void detachFileLogSink();
   List<String> getAllCategoryNames();
+
+  ClientResetMetrics get clientResetMetrics;
+  Map<String, NativeHandleStats> get nativeHandleStats;
+  int get handleSampleInterval;
+  set handleSampleInterval(int value);
+  List<HandleAllocationSample> get handleAllocationSamples;
   void setLogLevel(LogLevel level, {required LogCategory category});
   void logMessage(LogCategory category, LogLevel logLevel, String message);
 
@@ -15,8 +15,9 @@ import 'native/realm_handle.dart' if (dart.library.js_interop) 'web/realm_handle
 abstract interface class RealmHandle extends HandleBase {
   factory RealmHandle.open(Configuration config) = impl.RealmHandle.open;
 
-  int addChild(HandleBase child);
-  void removeChild(int id);
+  void beginScope();
+  void endScope();
+  void escape(HandleBase handle);
 
   @override
   void releaseCore();
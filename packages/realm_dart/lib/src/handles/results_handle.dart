@@ -6,6 +6,7 @@ import 'package:realm_dart/src/handles/notification_token_handle.dart';
 
 import '../realm_class.dart';
 import 'object_handle.dart';
+import 'object_slab_handle.dart';
 import 'realm_handle.dart';
 
 abstract interface class ResultsHandle extends HandleBase {
@@ -14,6 +15,8 @@ abstract interface class ResultsHandle extends HandleBase {
   int find(Object? value);
 
   ObjectHandle getObjectAt(int index);
+  ObjectSlabHandle createObjectSlab();
+  ObjectHandle borrowObjectAt(ObjectSlabHandle slab, int index);
 
   int get count;
 
@@ -24,5 +27,11 @@ abstract interface class ResultsHandle extends HandleBase {
   ResultsHandle resolveIn(RealmHandle realmHandle);
 
   Object? elementAt(Realm realm, int index);
+
+  Object? sum(int propertyKey);
+  Object? min(int propertyKey);
+  Object? max(int propertyKey);
+  Object? average(int propertyKey);
+
   NotificationTokenHandle subscribeForNotifications(NotificationsController controller, List<String>? keyPaths, int? classKey);
 }
@@ -7,8 +7,38 @@ import 'handle_base.dart';
 
 import 'native/scheduler_handle.dart' if (dart.library.js_interop) 'web/scheduler_handle.dart' as impl;
 
+/// Counters describing how the native scheduler has woken up the isolate.
+///
+/// [coalescedCount] is the number of port messages saved by folding notifications
+/// into an already pending wake-up. [deferredCount] is the number of times work
+/// was pushed to a later event loop turn, because the drain budget ran out.
+///
+/// The latencies measure the time from core handing work to the scheduler, on
+/// any thread, until the work starts running on the isolate. Percentiles are
+/// approximate, rounded up to the next power of two microseconds.
+typedef SchedulerStats = ({
+  int notifyCount,
+  int postCount,
+  int coalescedCount,
+  int invokeCount,
+  int drainedCount,
+  int deferredCount,
+  Duration latencyP50,
+  Duration latencyP99,
+  Duration latencyMax,
+});
+
+/// The number of work queues waiting on each native lane of the scheduler.
+typedef SchedulerLaneDepths = ({int notifications, int callbacks});
+
 abstract interface class SchedulerHandle extends HandleBase {
   factory SchedulerHandle(int isolateId, SendPort port) = impl.SchedulerHandle;
 
-  void invoke(int workQueue);
+  void invoke(int schedulerData);
+
+  SchedulerStats get stats;
+
+  SchedulerLaneDepths get laneDepths;
+
+  void setDrainBudget(Duration? budget);
 }
@@ -28,6 +28,7 @@ abstract interface class SessionHandle extends HandleBase {
   SyncSessionNotificationTokenHandle subscribeForProgressNotifications(
     ProgressDirection direction,
     ProgressMode mode,
+    Duration interval,
     SessionProgressNotificationsController controller,
   );
 }
@@ -1,6 +1,9 @@
 // Copyright 2024 MongoDB, Inc.
 // SPDX-License-Identifier: Apache-2.0
 
+import 'dart:collection';
+import 'dart:typed_data';
+
 import 'package:decimal/decimal.dart';
 
 import 'package:realm_dart/src/convert.dart';
@@ -56,6 +59,9 @@ class Decimal128 implements intf.Decimal128 {
     return Decimal128._(Decimal.parse(value.toString()));
   }
 
+  /// Formats all [values], returning the same strings as [toString].
+  static List<String> formatAll(Iterable<Decimal128> values) => [for (final value in values) value.toString()];
+
   final Decimal _value;
   Decimal128._(Decimal value) : _value = value.truncate(scale: 6144);
 
@@ -113,3 +119,63 @@ class Decimal128 implements intf.Decimal128 {
   @override
   int get hashCode => _value.hashCode;
 }
+
+/// A fixed-length list of [Decimal128] values. On the web the operations are simply applied element by element.
+class Decimal128List with ListMixin<intf.Decimal128> implements intf.Decimal128List {
+  final List<Decimal128> _values;
+
+  Decimal128List(int length) : _values = List.filled(length, Decimal128.zero);
+
+  Decimal128List.fromList(Iterable<intf.Decimal128> values) : _values = values.cast<Decimal128>().toList(growable: false);
+
+  @override
+  int get length => _values.length;
+
+  @override
+  set length(int newLength) => throw UnsupportedError('Cannot change the length of a fixed-length list');
+
+  @override
+  Decimal128 operator [](int index) => _values[index];
+
+  @override
+  void operator []=(int index, covariant Decimal128 value) => _values[index] = value;
+
+  @override
+  Decimal128List combine(covariant Decimal128List other, intf.Decimal128Operation operation) {
+    _checkSameLength(other);
+    final op = switch (operation) {
+      intf.Decimal128Operation.add => (Decimal128 x, Decimal128 y) => x + y,
+      intf.Decimal128Operation.subtract => (Decimal128 x, Decimal128 y) => x - y,
+      intf.Decimal128Operation.multiply => (Decimal128 x, Decimal128 y) => x * y,
+      intf.Decimal128Operation.divide => (Decimal128 x, Decimal128 y) => x / y,
+    };
+    return Decimal128List.fromList([for (var i = 0; i < length; i++) op(_values[i], other._values[i])]);
+  }
+
+  @override
+  Decimal128 sum() => _values.fold(Decimal128.zero, (sum, value) => sum + value);
+
+  @override
+  Decimal128 min() => _values.isEmpty ? Decimal128.nan : _values.reduce((a, b) => b < a ? b : a);
+
+  @override
+  Decimal128 max() => _values.isEmpty ? Decimal128.nan : _values.reduce((a, b) => b > a ? b : a);
+
+  @override
+  Decimal128 average() => _values.isEmpty ? Decimal128.nan : sum() / Decimal128.fromInt(length);
+
+  @override
+  Int32List compareEach(covariant Decimal128List other) {
+    _checkSameLength(other);
+    return Int32List.fromList([for (var i = 0; i < length; i++) _values[i].compareTo(other._values[i])]);
+  }
+
+  @override
+  void sort([int Function(intf.Decimal128 a, intf.Decimal128 b)? compare]) => _values.sort(compare ?? (a, b) => a.compareTo(b));
+
+  void _checkSameLength(Decimal128List other) {
+    if (other.length != length) {
+      throw ArgumentError.value(other, 'other', 'Expected a list of length $length, but got ${other.length}');
+    }
+  }
+}
@@ -0,0 +1,7 @@
+// Copyright 2024 MongoDB, Inc.
+// SPDX-License-Identifier: Apache-2.0
+
+import '../object_slab_handle.dart' as intf;
+import 'handle_base.dart';
+
+class ObjectSlabHandle extends HandleBase implements intf.ObjectSlabHandle {}
@@ -268,6 +268,18 @@ extension RealmListOfObject<T extends RealmObjectBase> on RealmList<T> {
 
     return (this as ManagedRealmList<T>)._changesFor(keyPaths);
   }
+
+  /// Returns the sum of [propertyName] over all objects in the list. See [RealmResultsOfObject.sum].
+  R sum<R extends Object>(String propertyName) => asResults().sum<R>(propertyName);
+
+  /// Returns the smallest value of [propertyName] over all objects in the list. See [RealmResultsOfObject.min].
+  R? min<R extends Object>(String propertyName) => asResults().min<R>(propertyName);
+
+  /// Returns the largest value of [propertyName] over all objects in the list. See [RealmResultsOfObject.max].
+  R? max<R extends Object>(String propertyName) => asResults().max<R>(propertyName);
+
+  /// Returns the average value of [propertyName] over all objects in the list. See [RealmResultsOfObject.average].
+  R? average<R extends Object>(String propertyName) => asResults().average<R>(propertyName);
 }
 
 /// @nodoc
@@ -277,6 +289,9 @@ extension RealmListInternal<T extends Object?> on RealmList<T> {
   ListHandle get handle {
     final result = asManaged()._handle;
     if (result.released) {
+      if (result.releasedByScope) {
+        throw RealmClosedError('Cannot access a list obtained in a Realm.scope that has ended');
+      }
       throw RealmClosedError('Cannot access a list that belongs to a closed Realm');
     }
 
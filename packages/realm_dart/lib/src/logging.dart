@@ -164,17 +164,31 @@ typedef LogRecord = ({LogCategory category, LogLevel level, String message});
 /// to stdout.
 class RealmLogger {
   static final _controller = StreamController<LogRecord>.broadcast(
-    onListen: () => realmCore.loggerAttach(),
+    onListen: () {
+      realmCore.loggerAttach();
+      // native filters are cleared on detach
+      _levels.forEach((category, level) => realmCore.setLogLevel(level, category: category));
+    },
     onCancel: () => realmCore.loggerDetach(),
   );
 
+  // The levels set by this isolate, in the order they were set
+  static final _levels = <LogCategory, LogLevel>{};
+
   const RealmLogger();
 
   /// Set the log [level] for the given [category].
   ///
   /// If [category] is not provided, the log level will be set [LogCategory.realm].
+  /// Setting a level for a category also applies to all its subcategories.
+  ///
+  /// Levels are set per isolate. The records of a category are delivered to this isolate if they
+  /// have at least the level set here, regardless of the levels other isolates set for it.
+  /// Records no isolate asked for are filtered out before they are even formatted.
   void setLogLevel(LogLevel level, {LogCategory? category}) {
     category ??= LogCategory.realm;
+    _levels.removeWhere((c, _) => category!.contains(c));
+    _levels[category] = level;
     realmCore.setLogLevel(level, category: category);
   }
 
@@ -184,6 +198,44 @@ class RealmLogger {
   /// If no listeners are attached in any isolate, the trace will go to stdout.
   Stream<LogRecord> get onRecord => _controller.stream;
 
+  /// Write log records to a text file at [path], directly from native code on a background thread.
+  ///
+  /// Records written to the file never pass through any isolate, which makes this suitable for high
+  /// volume diagnostics, such as tracing the sync client in production. The sink is shared by the whole
+  /// process and keeps writing until [detachFileSink] is called, even if no isolate listens to [onRecord].
+  /// Attaching a new sink replaces the previous one.
+  ///
+  /// The file is memory mapped and has a fixed size of [maxFileSize] bytes. When it is full, it is renamed
+  /// to `path.1`, `path.1` to `path.2` and so on, keeping at most [maxFileCount] files. An existing file
+  /// at [path] is rotated the same way.
+  ///
+  /// [levels] sets the level of records written to the file per category, with more specific categories
+  /// taking precedence over their parents. Categories without a level are written at the level set with [setLogLevel].
+  void attachFileSink(
+    String path, {
+    int maxFileSize = 16 * 1024 * 1024,
+    int maxFileCount = 4,
+    Map<LogCategory, LogLevel> levels = const {},
+  }) {
+    if (maxFileSize <= 0) {
+      throw ArgumentError.value(maxFileSize, 'maxFileSize', 'must be positive');
+    }
+    if (maxFileCount <= 0) {
+      throw ArgumentError.value(maxFileCount, 'maxFileCount', 'must be positive');
+    }
+    realmCore.attachFileLogSink(path, maxFileSize: maxFileSize, maxFileCount: maxFileCount, levels: levels);
+  }
+
+  /// Stop writing log records to the file attached with [attachFileSink].
+  void detachFileSink() => realmCore.detachFileLogSink();
+
+  /// The number of log records dropped since the process started, across all isolates.
+  ///
+  /// Log records are queued by the native code emitting them and delivered in the background,
+  /// so logging never blocks the sync client. If records are logged faster than they can be delivered,
+  /// for instance at [LogLevel.trace], the excess is dropped and a warning is delivered in their place.
+  int get droppedRecordCount => realmCore.loggerDroppedCount;
+
   void _raise(LogRecord record) {
     _controller.add(record);
   }
@@ -249,6 +249,9 @@ extension RealmMapInternal<T extends Object?> on RealmMap<T> {
   MapHandle get handle {
     final result = asManaged()._handle;
     if (result.released) {
+      if (result.releasedByScope) {
+        throw RealmClosedError('Cannot access a map obtained in a Realm.scope that has ended');
+      }
       throw RealmClosedError('Cannot access a map that belongs to a closed Realm');
     }
 
@@ -6,6 +6,7 @@ import 'dart:isolate';
 
 import 'package:cancellation_token/cancellation_token.dart';
 import 'package:collection/collection.dart';
+import 'package:meta/meta.dart';
 import 'package:realm_common/realm_common.dart';
 
 import 'configuration.dart';
@@ -17,6 +18,7 @@ import 'handles/notification_token_handle.dart';
 import 'handles/object_handle.dart';
 import 'handles/realm_core.dart';
 import 'handles/realm_handle.dart';
+import 'handles/scheduler_handle.dart';
 import 'handles/set_handle.dart';
 import 'list.dart';
 import 'logging.dart';
@@ -59,7 +61,7 @@ export 'package:realm_common/realm_common.dart'
         Uuid;
 
 // always expose with `show` to explicitly control the public API surface
-export 'app.dart' show AppException, App, MetadataPersistenceMode, AppConfiguration, SyncTimeoutOptions;
+export 'app.dart' show AppException, App, MetadataPersistenceMode, AppConfiguration, SyncTimeoutOptions, HttpMethod, HttpEndpointMetrics;
 export 'collections.dart' show Move;
 export "configuration.dart"
     show
@@ -69,6 +71,7 @@ export "configuration.dart"
         ClientResetCallback,
         ClientResetError,
         ClientResetHandler,
+        ClientResetMetrics,
         CompensatingWriteError,
         CompensatingWriteInfo,
         Configuration,
@@ -88,7 +91,9 @@ export "configuration.dart"
         SyncError,
         SyncErrorHandler;
 export 'credentials.dart' show AuthProviderType, Credentials, EmailPasswordAuthProvider;
-export 'handles/decimal128.dart' show Decimal128;
+export 'handles/decimal128.dart' show Decimal128, Decimal128List, Decimal128Operation;
+export 'handles/realm_core.dart' show HandleAllocationSample, NativeHandleStats;
+export 'handles/scheduler_handle.dart' show SchedulerStats;
 export 'list.dart' show RealmList, RealmListOfObject, RealmListChanges, ListExtension;
 export 'logging.dart' hide RealmLoggerInternal;
 export 'map.dart' show RealmMap, RealmMapChanges, RealmMapOfObject;
@@ -385,6 +390,56 @@ class Realm {
     }
   }
 
+  /// Runs [body] and then releases the native resources of the objects, collections and
+  /// results of this `Realm` obtained while it ran, instead of leaving that to the garbage collector.
+  ///
+  /// This keeps the native memory of long scans bounded, for instance in batch jobs:
+  /// ```dart
+  /// for (final id in ids) {
+  ///   realm.scope(() => process(realm.query<Item>(r'batch == $0', [id])));
+  /// }
+  /// ```
+  ///
+  /// Objects and collections obtained in the scope can't be used once it ends, unless they are
+  /// passed to [escape] first. The value returned by [body] is escaped if it is an object or a
+  /// collection. Scopes can be nested, and an entity escaping an inner scope belongs to the outer one.
+  ///
+  /// [body] must be synchronous. Notification subscriptions made in the scope are not affected.
+  T scope<T>(T Function() body) {
+    assert(body is! Future<Object?> Function(), 'Realm.scope requires a synchronous body');
+    handle.beginScope();
+    try {
+      final result = body();
+      if (result is RealmEntity) {
+        escape(result);
+      }
+      return result;
+    } finally {
+      if (!isClosed) {
+        _handle.endScope();
+      }
+    }
+  }
+
+  /// Keeps [entity] usable after the innermost [scope] it was obtained in ends.
+  E escape<E extends RealmEntity>(E entity) {
+    if (!entity.isManaged) {
+      return entity;
+    }
+    final entityHandle = switch (entity) {
+      RealmObjectBase object => object.handle,
+      RealmResults results => results.handle,
+      RealmList list => list.handle,
+      RealmSet set => set.handle,
+      RealmMap map => map.handle,
+      _ => null,
+    };
+    if (entityHandle != null) {
+      handle.escape(entityHandle);
+    }
+    return entity;
+  }
+
   /// Closes the `Realm`.
   ///
   /// All [RealmObject]s and `Realm ` collections are invalidated and can not be used.
@@ -514,6 +569,29 @@ class Realm {
   /// The default log level is [LogLevel.info].
   static const logger = RealmLogger();
 
+  /// The maximum time the current isolate spends delivering notifications and
+  /// callbacks from the database and sync operations in one go.
+  ///
+  /// When set, work that doesn't fit within the budget is deferred to a later turn of
+  /// the event loop, rather than being run all at once. This is useful on Flutter to
+  /// avoid missing frames when a large sync download triggers many callbacks.
+  /// A budget of a few milliseconds, for instance `Duration(milliseconds: 4)`, is
+  /// usually a good fit. Defaults to `null`, meaning no limit.
+  static Duration? get schedulerDrainBudget => scheduler.drainBudget;
+  static set schedulerDrainBudget(Duration? value) => scheduler.drainBudget = value;
+
+  /// Counters and notify-to-run latencies for the delivery of notifications and
+  /// callbacks on the current isolate.
+  ///
+  /// Use this to tell whether notification latency is spent waiting for the isolate
+  /// to pick up work, or elsewhere.
+  static SchedulerStats get schedulerStats => scheduler.stats;
+
+  /// Diagnostics of the native handles held by Realm objects, collections and other classes,
+  /// to track their native memory and hunt for leaks.
+  @experimental
+  static RealmDiagnostics get diagnostics => const RealmDiagnostics._();
+
   /// Used to shutdown Realm and allow the process to correctly release native resources and exit.
   ///
   /// Disclaimer: This method is mostly needed on Dart standalone and if not called the Dart program will hang and not exit.
@@ -651,6 +729,35 @@ class RealmSchemaChanges {
   RealmSchemaChanges._(this.currentSchema, this.newSchema);
 }
 
+/// Diagnostics of the native handles held by Realm objects, collections and other classes,
+/// as returned by [Realm.diagnostics].
+@experimental
+class RealmDiagnostics {
+  const RealmDiagnostics._();
+
+  /// The census of the native handles in the process by type of handle, such as `object`,
+  /// `results` or `realm`.
+  ///
+  /// The native bytes are also reported to the Dart garbage collector, so that it collects
+  /// handles more eagerly as the native memory they hold grows. A [NativeHandleStats.liveCount]
+  /// that keeps growing while [NativeHandleStats.finalizedCount] doesn't points at a leak.
+  Map<String, NativeHandleStats> get handles => realmCore.nativeHandleStats;
+
+  /// Records where one in [allocationSampleInterval] handles created on the current isolate
+  /// is allocated, or none if it is 0, which is the default.
+  ///
+  /// Capturing a stack trace is expensive, so keep sampling to debug sessions, with an
+  /// interval of a few hundreds or more when many objects are read.
+  int get allocationSampleInterval => realmCore.handleSampleInterval;
+  set allocationSampleInterval(int value) => realmCore.handleSampleInterval = value;
+
+  /// Where the sampled handles that still hold their native object were created, oldest first.
+  ///
+  /// Handles that are released, explicitly or by the garbage collector, are left out, so
+  /// samples that stay around long after the work that created them are likely leaks.
+  List<HandleAllocationSample> get allocationSamples => realmCore.handleAllocationSamples;
+}
+
 /// Provides a scope to safely write data to a [Realm]. Can be created using [Realm.beginWrite] or
 /// [Realm.beginWriteAsync].
 class Transaction {
@@ -680,7 +680,11 @@ extension RealmObjectInternal on RealmObjectBase {
   }
 
   ObjectHandle get handle {
-    if (_handle?.released == true) {
+    final handle = _handle;
+    if (handle != null && handle.released) {
+      if (handle.releasedByScope) {
+        throw RealmClosedError('Cannot access an object obtained in a Realm.scope that has ended');
+      }
       throw RealmClosedError('Cannot access an object that belongs to a closed Realm');
     }
 
@@ -10,6 +10,7 @@ import 'handles/collection_changes_handle.dart';
 import 'handles/handle_base.dart';
 import 'handles/notification_token_handle.dart';
 import 'handles/object_handle.dart';
+import 'handles/object_slab_handle.dart';
 import 'handles/results_handle.dart';
 import 'realm_class.dart';
 import 'realm_object.dart';
@@ -114,6 +115,13 @@ class RealmResults<T extends Object?> extends Iterable<T> with RealmEntity {
   @override
   int get length => handle.count - _skipOffset;
 
+  /// Creates a [List] containing the elements of this `Results` collection.
+  ///
+  /// The objects in the list are retained, so they are created as owned objects
+  /// up front instead of being borrowed like the ones created while iterating.
+  @override
+  List<T> toList({bool growable = true}) => List<T>.generate(length, elementAt, growable: growable);
+
   @override
   T get first {
     if (length == 0) {
@@ -186,6 +194,42 @@ extension RealmResultsOfObject<T extends RealmObjectBase> on RealmResults<T> {
   /// If [keyPaths] is null, default notifications will be raised (same as [RealmResults.change]).
   /// If [keyPaths] is an empty list, only notifications related to the collection itself will be raised (such as adding or removing elements).
   Stream<RealmResultsChanges<T>> changesFor([List<String>? keyPaths]) => _changesFor(keyPaths);
+
+  /// Returns the sum of [propertyName] over all objects in the results.
+  ///
+  /// The sum is computed by the database, without reading the objects into Dart.
+  /// Supports `int`, `double` and [Decimal128] properties. The sum of no objects is zero.
+  R sum<R extends Object>(String propertyName) => _aggregate(propertyName, (handle, key) => handle.sum(key)) as R;
+
+  /// Returns the smallest value of [propertyName] over all objects in the results, or `null` if there are none.
+  ///
+  /// The minimum is computed by the database, without reading the objects into Dart.
+  /// Supports `int`, `double`, [Decimal128] and [DateTime] properties.
+  R? min<R extends Object>(String propertyName) => _aggregate(propertyName, (handle, key) => handle.min(key)) as R?;
+
+  /// Returns the largest value of [propertyName] over all objects in the results, or `null` if there are none.
+  ///
+  /// The maximum is computed by the database, without reading the objects into Dart.
+  /// Supports `int`, `double`, [Decimal128] and [DateTime] properties.
+  R? max<R extends Object>(String propertyName) => _aggregate(propertyName, (handle, key) => handle.max(key)) as R?;
+
+  /// Returns the average value of [propertyName] over all objects in the results, or `null` if there are none.
+  ///
+  /// The average is computed by the database, without reading the objects into Dart.
+  /// Supports `int`, `double` and [Decimal128] properties. The average of `int` and `double`
+  /// properties is a `double`, and the average of [Decimal128] properties is a [Decimal128].
+  R? average<R extends Object>(String propertyName) => _aggregate(propertyName, (handle, key) => handle.average(key)) as R?;
+
+  Object? _aggregate(String propertyName, Object? Function(ResultsHandle handle, int propertyKey) aggregate) {
+    if (_skipOffset > 0) {
+      throw RealmStateError('Aggregates are not supported on results returned by skip');
+    }
+    final property = _metadata![propertyName];
+    if (property.collectionType != RealmCollectionType.none) {
+      throw RealmStateError('Aggregates are not supported on collection property $propertyName');
+    }
+    return aggregate(handle, property.key);
+  }
 }
 
 class _SubscribedRealmResult<T extends RealmObject> extends RealmResults<T> {
@@ -286,6 +330,9 @@ extension RealmResultsOfRealmObject<T extends RealmObject> on RealmResults<T> {
 extension RealmResultsInternal on RealmResults {
   ResultsHandle get handle {
     if (_handle.released) {
+      if (_handle.releasedByScope) {
+        throw RealmClosedError('Cannot access Results obtained in a Realm.scope that has ended');
+      }
       throw RealmClosedError('Cannot access Results that belongs to a closed Realm');
     }
 
@@ -352,13 +399,29 @@ class _RealmResultsIterator<T extends Object?> implements Iterator<T> {
   final RealmResults<T> _results;
   int _index;
   T? _current;
+  bool _inRange = false;
+
+  // Objects are borrowed from a slab rather than given a finalizer each. A full slab stops
+  // lending as iteration moves on, and so does the last one when iteration ends. Objects
+  // used after that are promoted to owned copies, so the slab can be collected.
+  ObjectSlabHandle? _slab;
 
   _RealmResultsIterator(RealmResults<T> results)
       : _results = results,
         _index = -1;
 
   @override
-  T get current => _current ??= _results[_index];
+  T get current => _current ??= _inRange && _results._supportsSnapshot ? _borrowCurrent() : _results[_index];
+
+  T _borrowCurrent() {
+    var slab = _slab;
+    if (slab == null || slab.isFull) {
+      slab?.stopLending();
+      slab = _slab = _results.handle.createObjectSlab();
+    }
+    final handle = _results.handle.borrowObjectAt(slab, _results._skipOffset + _index);
+    return _results.realm.createObject(T, handle, _results._metadata!) as T;
+  }
 
   @override
   bool moveNext() {
@@ -366,8 +429,12 @@ class _RealmResultsIterator<T extends Object?> implements Iterator<T> {
     _current = null;
     _index++;
     if (_index >= length) {
+      _inRange = false;
+      _slab?.stopLending();
+      _slab = null;
       return false;
     }
+    _inRange = true;
     return true;
   }
 }
@@ -2,10 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 
 import 'dart:async';
+import 'dart:collection';
+import 'dart:convert';
 import 'dart:isolate';
+import 'dart:typed_data';
 
 import 'package:realm_dart/src/logging.dart';
 
+import 'handles/realm_core.dart';
 import 'handles/scheduler_handle.dart';
 import 'realm_class.dart';
 
@@ -34,20 +38,79 @@ class Scheduler {
     handle = SchedulerHandle(Isolate.current.hashCode, sendPort);
   }
 
+  Duration? _drainBudget;
+
+  // Log records are the lowest priority lane. They are buffered here and raised on
+  // a later turn of the event loop, after wake-ups already in the port queue.
+  final Queue<LogRecord> _logs = Queue<LogRecord>();
+  bool _logFlushScheduled = false;
+
+  // Log records refer to their category by its index in the native list of categories
+  late final List<LogCategory> _logCategories = realmCore.getAllCategoryNames().map(LogCategory.fromString).toList();
+
+  /// The maximum time spent running queued notifications and callbacks per
+  /// wake-up of this isolate. Remaining work is deferred to a later turn of
+  /// the event loop. `null` means no limit.
+  Duration? get drainBudget => _drainBudget;
+  set drainBudget(Duration? value) {
+    if (value != null && value <= Duration.zero) {
+      throw ArgumentError.value(value, 'drainBudget', 'must be positive');
+    }
+    handle.setDrainBudget(value);
+    _drainBudget = value;
+  }
+
+  /// Counters and notify-to-run latencies of this isolate's scheduler, since it
+  /// was created.
+  SchedulerStats get stats => handle.stats;
+
+  /// The number of items waiting on each lane of this isolate's scheduler.
+  ///
+  /// Lanes are served in priority order: change notifications first, then
+  /// sync and app callbacks, and finally log records.
+  ({int notifications, int callbacks, int logs}) get laneDepths {
+    final native = handle.laneDepths;
+    return (notifications: native.notifications, callbacks: native.callbacks, logs: _logs.length);
+  }
+
   void _handle(dynamic message) {
     if (message is List) {
-      // currently the only `message as List` is from the logger.
-      final category = LogCategory.fromString(message[0] as String);
-      final level = LogLevel.values[message[1] as int];
-      final text = message[2] as String;
-      Realm.logger.raise((category: category, level: level, message: text));
+      // currently the only `message as List` is a batch of records from the logger.
+      // See LogBatch in realm_dart_logger.cpp for the layout.
+      final levels = message[0] as Uint8List;
+      final categoryIds = message[1] as Uint16List;
+      final messageEnds = message[2] as Uint32List;
+      final text = message[3] as Uint8List;
+      var start = 0;
+      for (var i = 0; i < levels.length; i++) {
+        final end = messageEnds[i];
+        _logs.add((
+          category: _logCategories[categoryIds[i]],
+          level: LogLevel.values[levels[i]],
+          message: utf8.decoder.convert(text, start, end),
+        ));
+        start = end;
+      }
+      if (!_logFlushScheduled) {
+        _logFlushScheduled = true;
+        Timer.run(_flushLogs);
+      }
     } else if (message is int) {
+      // a wake-up from the native scheduler. All work queued since the last
+      // wake-up is drained in one go.
       handle.invoke(message);
     } else {
       Realm.logger.log(LogLevel.error, 'Unexpected Scheduler message type: ${message.runtimeType} - $message');
     }
   }
 
+  void _flushLogs() {
+    _logFlushScheduled = false;
+    while (_logs.isNotEmpty) {
+      Realm.logger.raise(_logs.removeFirst());
+    }
+  }
+
   void stop() {
     if (handle.released) {
       return;
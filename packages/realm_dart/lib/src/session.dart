@@ -50,8 +50,15 @@ class Session {
   Future<void> waitForDownload([CancellationToken? cancellationToken]) => handle.waitForDownload(cancellationToken);
 
   /// Gets a [Stream] of [SyncProgress] that can be used to track upload or download progress.
-  Stream<SyncProgress> getProgressStream(ProgressDirection direction, ProgressMode mode) {
-    final controller = SessionProgressNotificationsController(this, direction, mode);
+  ///
+  /// Progress updates are coalesced natively. Only the latest update is kept while one is waiting to be
+  /// delivered, and updates are delivered at most once per [interval]. The latest update is delivered once
+  /// the interval has passed, and the update completing the transfer is delivered right away.
+  Stream<SyncProgress> getProgressStream(ProgressDirection direction, ProgressMode mode, {Duration interval = Duration.zero}) {
+    if (interval.isNegative) {
+      throw ArgumentError.value(interval, 'interval', 'must not be negative');
+    }
+    final controller = SessionProgressNotificationsController(this, direction, mode, interval);
     return controller.createStream();
   }
 
@@ -112,11 +119,12 @@ class SessionProgressNotificationsController implements ProgressNotificationsCon
   final Session _session;
   final ProgressDirection _direction;
   final ProgressMode _mode;
+  final Duration _interval;
 
   SyncSessionNotificationTokenHandle? _tokenHandle;
   late final StreamController<SyncProgress> _streamController;
 
-  SessionProgressNotificationsController(this._session, this._direction, this._mode);
+  SessionProgressNotificationsController(this._session, this._direction, this._mode, [this._interval = Duration.zero]);
 
   Stream<SyncProgress> createStream() {
     _streamController = StreamController<SyncProgress>(onListen: _start, onCancel: _stop);
@@ -136,7 +144,7 @@ class SessionProgressNotificationsController implements ProgressNotificationsCon
     if (_tokenHandle != null) {
       throw RealmStateError("Session progress subscription already started.");
     }
-    _tokenHandle = _session.handle.subscribeForProgressNotifications(_direction, _mode, this);
+    _tokenHandle = _session.handle.subscribeForProgressNotifications(_direction, _mode, _interval, this);
   }
 
   void _stop() {
@@ -295,6 +295,9 @@ extension RealmSetInternal<T extends Object?> on RealmSet<T> {
   SetHandle get handle {
     final result = asManaged()._handle;
     if (result.released) {
+      if (result.releasedByScope) {
+        throw RealmClosedError('Cannot access a RealmSet obtained in a Realm.scope that has ended');
+      }
       throw RealmClosedError('Cannot access a RealmSet that belongs to a closed Realm');
     }
 
@@ -400,6 +403,18 @@ extension RealmSetOfObject<T extends RealmObjectBase> on RealmSet<T> {
 
     return (this as ManagedRealmSet<T>)._changesFor(keyPaths);
   }
+
+  /// Returns the sum of [propertyName] over all objects in the set. See [RealmResultsOfObject.sum].
+  R sum<R extends Object>(String propertyName) => asResults().sum<R>(propertyName);
+
+  /// Returns the smallest value of [propertyName] over all objects in the set. See [RealmResultsOfObject.min].
+  R? min<R extends Object>(String propertyName) => asResults().min<R>(propertyName);
+
+  /// Returns the largest value of [propertyName] over all objects in the set. See [RealmResultsOfObject.max].
+  R? max<R extends Object>(String propertyName) => asResults().max<R>(propertyName);
+
+  /// Returns the average value of [propertyName] over all objects in the set. See [RealmResultsOfObject.average].
+  R? average<R extends Object>(String propertyName) => asResults().average<R>(propertyName);
 }
 
 extension on RealmSet {
@@ -19,10 +19,16 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <atomic>
 #include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include "realm_dart.h"
 #include "realm_dart.hpp"
+#include <realm/object-store/c_api/util.hpp>
 
 #if REALM_ARCHITECTURE_ARM32 || REALM_ARCHITECTURE_ARM64 || REALM_ARCHITECTURE_X86_32 || REALM_ARCHITECTURE_X86_64
 #if REALM_ARCHITECTURE_ARM32
@@ -73,7 +79,8 @@ RLM_API void realm_dart_userdata_async_free(void* userdata) {
 }
 
 RLM_API void realm_dart_invoke_unlock_callback(realm_userdata_t error, void* unlockFunc) {
-    auto castFunc = (reinterpret_cast<realm::util::UniqueFunction<void(realm_userdata_t)>*>(unlockFunc));
+    // the unlock function is allocated for a single call
+    std::unique_ptr<realm::util::UniqueFunction<void(realm_userdata_t)>> castFunc(reinterpret_cast<realm::util::UniqueFunction<void(realm_userdata_t)>*>(unlockFunc));
     (*castFunc)(error);
 }
 
@@ -87,23 +94,318 @@ RLM_API const char* realm_dart_library_version() { return "3.4.2"; }
 //     Dart_ExecuteInternalCommand_DL("gc-now", nullptr);
 // }
 
-void handle_finalizer(void* isolate_callback_data, void* realmPtr) {
-    realm_release(realmPtr);
+// A handle borrowing an object from a slab has no finalizer of its own. The slab is a single finalizable handle,
+// and its objects are released together with it. Borrowed handles keep the slab alive until they are promoted,
+// so the objects they are promoted from are the very ones they borrowed, rather than whatever has their key now.
+struct realm_dart_object_slab : realm::c_api::WrapC {
+    explicit realm_dart_object_slab(size_t capacity) {
+        objects.reserve(capacity);
+    }
+
+    ~realm_dart_object_slab() {
+        for (auto object : objects) {
+            realm_release(object);
+        }
+    }
+
+    std::vector<realm_object_t*> objects;
+};
+
+namespace {
+const char* const handle_type_names[RLM_DART_HANDLE_TYPE_COUNT] = {
+    "other", "realm", "object", "objectSlab", "results", "list", "set", "dictionary", "query", "changes", "notificationToken",
+    "config", "schema", "scheduler", "app", "user", "credentials", "session", "subscription", "asyncOpenTask", "httpTransport",
+};
+
+struct HandleTypeStats {
+    std::atomic<int64_t> live_count{ 0 };
+    std::atomic<int64_t> live_bytes{ 0 };
+    std::atomic<uint64_t> created_count{ 0 };
+    std::atomic<uint64_t> finalized_count{ 0 };
+    std::atomic<int64_t> pending_finalizer_count{ 0 };
+};
+
+HandleTypeStats handle_stats[RLM_DART_HANDLE_TYPE_COUNT];
+
+struct Finalizer {
+    Dart_FinalizableHandle handle;
+    void* realm_ptr;
+    realm_dart_handle_type_e type;
+    size_t size;
+    // the links of the handle in the level of the registry it is a child at, if any
+    realm_dart_child_registry* registry = nullptr;
+    size_t level = 0;
+    Finalizer* prev = nullptr;
+    Finalizer* next = nullptr;
+};
+
+// Guards the links of all registries, as finalizers may run on another thread than the isolate.
+std::mutex child_registry_mutex;
+
+// The memory held by a native object, as far as it is not shared with other handles. Objects behind a
+// shared pointer, such as the realm or the app, are not counted, nor are the data of the database file.
+size_t native_size(realm_dart_handle_type_e type, void* realm_ptr) {
+    auto wrapped = static_cast<realm::c_api::WrapC*>(realm_ptr);
+    switch (type) {
+        case RLM_DART_HANDLE_TYPE_REALM:
+            return sizeof(realm_t);
+        case RLM_DART_HANDLE_TYPE_OBJECT:
+            return sizeof(realm_object_t);
+        case RLM_DART_HANDLE_TYPE_OBJECT_SLAB: {
+            auto slab = static_cast<realm_dart_object_slab*>(wrapped);
+            return sizeof(realm_dart_object_slab) + slab->objects.capacity() * (sizeof(realm_object_t*) + sizeof(realm_object_t));
+        }
+        case RLM_DART_HANDLE_TYPE_RESULTS: {
+            auto results = static_cast<realm_results_t*>(wrapped);
+            // once evaluated, results hold the key of every row they contain. Getting their size may bring them
+            // up to date, which throws if they were invalidated, and this is called across FFI where it must not.
+            if (results->get_mode() == realm::Results::Mode::TableView) {
+                try {
+                    return sizeof(realm_results_t) + results->size() * sizeof(realm::ObjKey);
+                }
+                catch (...) {
+                }
+            }
+            return sizeof(realm_results_t);
+        }
+        case RLM_DART_HANDLE_TYPE_LIST:
+            return sizeof(realm_list_t);
+        case RLM_DART_HANDLE_TYPE_SET:
+            return sizeof(realm_set_t);
+        case RLM_DART_HANDLE_TYPE_DICTIONARY:
+            return sizeof(realm_dictionary_t);
+        case RLM_DART_HANDLE_TYPE_QUERY:
+            return sizeof(realm_query_t);
+        case RLM_DART_HANDLE_TYPE_CHANGES:
+            if (auto changes = dynamic_cast<realm_collection_changes_t*>(wrapped)) {
+                size_t deletions, insertions, modifications, moves;
+                realm_collection_changes_get_num_ranges(changes, &deletions, &insertions, &modifications, &moves);
+                // modifications are held both before and after the change
+                return sizeof(realm_collection_changes_t) + (deletions + insertions + 2 * modifications + moves) * 2 * sizeof(size_t);
+            }
+            if (auto changes = dynamic_cast<realm_dictionary_changes_t*>(wrapped)) {
+                size_t deletions, insertions, modifications;
+                bool cleared;
+                realm_dictionary_get_changes(changes, &deletions, &insertions, &modifications, &cleared);
+                return sizeof(realm_dictionary_changes_t) + (deletions + insertions + modifications) * sizeof(realm::Mixed);
+            }
+            if (auto changes = dynamic_cast<realm_object_changes_t*>(wrapped)) {
+                return sizeof(realm_object_changes_t) + realm_object_changes_get_num_modified_properties(changes) * sizeof(realm_property_key_t);
+            }
+            return sizeof(realm::c_api::WrapC);
+        case RLM_DART_HANDLE_TYPE_CONFIG:
+            if (auto config = dynamic_cast<realm_config_t*>(wrapped)) {
+                return sizeof(realm_config_t) + config->path.capacity();
+            }
+            return sizeof(realm_app_config_t);
+        case RLM_DART_HANDLE_TYPE_SCHEMA:
+            return sizeof(realm_schema_t);
+        case RLM_DART_HANDLE_TYPE_CREDENTIALS:
+            return sizeof(realm_app_credentials_t);
+        default:
+            // the remaining handles wrap a shared pointer or a token
+            return sizeof(realm::c_api::WrapC) + sizeof(std::shared_ptr<void>);
+    }
+}
+
+void account(realm_dart_handle_type_e type, int64_t count, int64_t bytes) {
+    handle_stats[type].live_count.fetch_add(count, std::memory_order_relaxed);
+    handle_stats[type].live_bytes.fetch_add(bytes, std::memory_order_relaxed);
 }
 
-RLM_API void* realm_attach_finalizer(Dart_Handle handle, void* realmPtr, int size) {
-    return Dart_NewFinalizableHandle_DL(handle, realmPtr, size, handle_finalizer);
+} // anonymous namespace
+
+// The children of a realm handle are linked into an intrusive list per level, so registering
+// a handle allocates nothing and releasing them all is a single call.
+struct realm_dart_child_registry : realm::c_api::WrapC {
+    ~realm_dart_child_registry() {
+        std::lock_guard lock(child_registry_mutex);
+        for (auto head : levels) {
+            for (auto child = head; child; child = child->next) {
+                child->registry = nullptr;
+            }
+        }
+    }
+
+    // Must be called with child_registry_mutex held
+    void link(Finalizer* child, size_t level) {
+        if (levels.size() <= level) {
+            levels.resize(level + 1, nullptr);
+        }
+        child->registry = this;
+        child->level = level;
+        child->prev = nullptr;
+        child->next = levels[level];
+        if (child->next) {
+            child->next->prev = child;
+        }
+        levels[level] = child;
+    }
+
+    // Must be called with child_registry_mutex held
+    static void unlink(Finalizer* child) {
+        auto registry = child->registry;
+        if (!registry) {
+            return;
+        }
+        if (child->prev) {
+            child->prev->next = child->next;
+        }
+        else {
+            registry->levels[child->level] = child->next;
+        }
+        if (child->next) {
+            child->next->prev = child->prev;
+        }
+        child->registry = nullptr;
+        child->prev = child->next = nullptr;
+    }
+
+    std::vector<Finalizer*> levels;
+};
+
+namespace {
+void handle_finalizer(void* isolate_callback_data, void* peer) {
+    std::unique_ptr<Finalizer> finalizer(static_cast<Finalizer*>(peer));
+    {
+        std::lock_guard lock(child_registry_mutex);
+        realm_dart_child_registry::unlink(finalizer.get());
+        if (!finalizer->realm_ptr) {
+            // already released with the other children of its registry
+            handle_stats[finalizer->type].pending_finalizer_count.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    handle_stats[finalizer->type].finalized_count.fetch_add(1, std::memory_order_relaxed);
+    account(finalizer->type, -1, -static_cast<int64_t>(finalizer->size));
+    realm_release(finalizer->realm_ptr);
 }
+} // anonymous namespace
 
-RLM_API void realm_detach_finalizer(void* finalizableHandle, Dart_Handle handle) {
-    Dart_FinalizableHandle finalHandle = reinterpret_cast<Dart_FinalizableHandle>(finalizableHandle);
-    return Dart_DeleteFinalizableHandle_DL(finalHandle, handle);
+RLM_API void* realm_attach_finalizer(Dart_Handle handle, void* realmPtr, realm_dart_handle_type_e type) {
+    const auto size = native_size(type, realmPtr);
+    auto finalizer = new Finalizer{ nullptr, realmPtr, type, size };
+    finalizer->handle = Dart_NewFinalizableHandle_DL(handle, finalizer, static_cast<intptr_t>(size), handle_finalizer);
+    account(type, 1, static_cast<int64_t>(size));
+    handle_stats[type].created_count.fetch_add(1, std::memory_order_relaxed);
+    return finalizer;
+}
+
+RLM_API void realm_detach_finalizer(void* finalizer, Dart_Handle handle) {
+    std::unique_ptr<Finalizer> detached(static_cast<Finalizer*>(finalizer));
+    Dart_DeleteFinalizableHandle_DL(detached->handle, handle);
+    {
+        std::lock_guard lock(child_registry_mutex);
+        realm_dart_child_registry::unlink(detached.get());
+    }
+    account(detached->type, -1, -static_cast<int64_t>(detached->size));
+}
+
+RLM_API void realm_dart_update_finalizer_size(void* finalizer, Dart_Handle handle) {
+    auto updated = static_cast<Finalizer*>(finalizer);
+    if (!updated->realm_ptr) {
+        return;
+    }
+    const auto size = native_size(updated->type, updated->realm_ptr);
+    if (size == updated->size) {
+        return;
+    }
+    Dart_UpdateFinalizableExternalSize_DL(updated->handle, handle, static_cast<intptr_t>(size));
+    account(updated->type, 0, static_cast<int64_t>(size) - static_cast<int64_t>(updated->size));
+    updated->size = size;
+}
+
+RLM_API void realm_dart_get_handle_stats(realm_dart_handle_stats_t* out_stats) {
+    for (int type = 0; type < RLM_DART_HANDLE_TYPE_COUNT; ++type) {
+        out_stats[type].type_name = handle_type_names[type];
+        out_stats[type].live_count = static_cast<uint64_t>(handle_stats[type].live_count.load(std::memory_order_relaxed));
+        out_stats[type].live_bytes = static_cast<uint64_t>(handle_stats[type].live_bytes.load(std::memory_order_relaxed));
+        out_stats[type].created_count = handle_stats[type].created_count.load(std::memory_order_relaxed);
+        out_stats[type].finalized_count = handle_stats[type].finalized_count.load(std::memory_order_relaxed);
+        out_stats[type].pending_finalizer_count =
+            static_cast<uint64_t>(handle_stats[type].pending_finalizer_count.load(std::memory_order_relaxed));
+    }
+}
+
+RLM_API realm_dart_child_registry_t* realm_dart_child_registry_new() {
+    return new realm_dart_child_registry();
+}
+
+RLM_API void realm_dart_child_registry_add(realm_dart_child_registry_t* registry, void* finalizer, size_t level) {
+    std::lock_guard lock(child_registry_mutex);
+    registry->link(static_cast<Finalizer*>(finalizer), level);
+}
+
+RLM_API void realm_dart_child_registry_move(realm_dart_child_registry_t* registry, void* finalizer, size_t level) {
+    auto child = static_cast<Finalizer*>(finalizer);
+    std::lock_guard lock(child_registry_mutex);
+    realm_dart_child_registry::unlink(child);
+    registry->link(child, level);
+}
+
+RLM_API void realm_dart_child_registry_remove(void* finalizer) {
+    std::lock_guard lock(child_registry_mutex);
+    realm_dart_child_registry::unlink(static_cast<Finalizer*>(finalizer));
+}
+
+RLM_API void realm_dart_child_registry_release(realm_dart_child_registry_t* registry, size_t level) {
+    std::vector<void*> released;
+    {
+        std::lock_guard lock(child_registry_mutex);
+        for (auto i = level; i < registry->levels.size(); ++i) {
+            for (auto child = registry->levels[i]; child;) {
+                auto next = child->next;
+                account(child->type, -1, -static_cast<int64_t>(child->size));
+                handle_stats[child->type].pending_finalizer_count.fetch_add(1, std::memory_order_relaxed);
+                released.push_back(child->realm_ptr);
+                child->realm_ptr = nullptr;
+                child->registry = nullptr;
+                child->prev = child->next = nullptr;
+                child = next;
+            }
+        }
+        registry->levels.resize(std::min(level, registry->levels.size()));
+    }
+    // released outside the lock, as releasing may take a while, e.g. for notification tokens
+    for (auto realm_ptr : released) {
+        realm_release(realm_ptr);
+    }
 }
 
 RLM_API void realm_set_auto_refresh(realm_t* realm, bool enable) {
     (*realm)->set_auto_refresh(enable);
 }
 
+RLM_API realm_dart_object_slab_t* realm_dart_object_slab_new(size_t capacity) {
+    return new realm_dart_object_slab(capacity);
+}
+
+RLM_API realm_object_t* realm_dart_object_slab_add_results_object(realm_dart_object_slab_t* slab, realm_results_t* results, size_t index) {
+    auto object = realm_results_get_object(results, index);
+    if (!object) {
+        return nullptr;
+    }
+    return realm::c_api::wrap_err([&]() -> realm_object_t* {
+        try {
+            slab->objects.push_back(object);
+        }
+        catch (...) {
+            realm_release(object);
+            throw;
+        }
+        return object;
+    });
+}
+
+RLM_API realm_object_t* realm_dart_object_slab_promote(const realm_dart_object_slab_t* slab, size_t slot) {
+    return realm::c_api::wrap_err([&]() -> realm_object_t* {
+        if (slot >= slab->objects.size()) {
+            throw realm::OutOfBounds("realm_dart_object_slab_promote", slot, slab->objects.size());
+        }
+        return static_cast<realm_object_t*>(realm_clone(slab->objects[slot]));
+    });
+}
+
 RLM_API const char* realm_get_library_cpu_arch() {
     return cpuArch.c_str();
 }
\ No newline at end of file
@@ -62,11 +62,119 @@ RLM_API const char* realm_dart_library_version();
 // for debugging only. Enable in realm_dart.cpp
 // RLM_API void realm_dart_gc();
 
-RLM_API void* realm_attach_finalizer(Dart_Handle handle, void* realmPtr, int size);
-RLM_API void realm_detach_finalizer(void* finalizableHandle, Dart_Handle handle);
+// The kinds of native objects held by Dart handles, for accounting of their memory
+typedef enum realm_dart_handle_type {
+    RLM_DART_HANDLE_TYPE_OTHER = 0,
+    RLM_DART_HANDLE_TYPE_REALM = 1,
+    RLM_DART_HANDLE_TYPE_OBJECT = 2,
+    RLM_DART_HANDLE_TYPE_OBJECT_SLAB = 3,
+    RLM_DART_HANDLE_TYPE_RESULTS = 4,
+    RLM_DART_HANDLE_TYPE_LIST = 5,
+    RLM_DART_HANDLE_TYPE_SET = 6,
+    RLM_DART_HANDLE_TYPE_DICTIONARY = 7,
+    RLM_DART_HANDLE_TYPE_QUERY = 8,
+    RLM_DART_HANDLE_TYPE_CHANGES = 9,
+    RLM_DART_HANDLE_TYPE_NOTIFICATION_TOKEN = 10,
+    RLM_DART_HANDLE_TYPE_CONFIG = 11,
+    RLM_DART_HANDLE_TYPE_SCHEMA = 12,
+    RLM_DART_HANDLE_TYPE_SCHEDULER = 13,
+    RLM_DART_HANDLE_TYPE_APP = 14,
+    RLM_DART_HANDLE_TYPE_USER = 15,
+    RLM_DART_HANDLE_TYPE_CREDENTIALS = 16,
+    RLM_DART_HANDLE_TYPE_SESSION = 17,
+    RLM_DART_HANDLE_TYPE_SUBSCRIPTION = 18,
+    RLM_DART_HANDLE_TYPE_ASYNC_OPEN_TASK = 19,
+    RLM_DART_HANDLE_TYPE_HTTP_TRANSPORT = 20,
+    RLM_DART_HANDLE_TYPE_COUNT = 21,
+} realm_dart_handle_type_e;
+
+typedef struct realm_dart_handle_stats {
+    const char* type_name;
+    // the number of handles of the type alive, and the native bytes they hold
+    uint64_t live_count;
+    uint64_t live_bytes;
+    // the number of handles of the type created since the process started, and of those whose native object
+    // was released by their GC finalizer, rather than explicitly or with their realm or scope
+    uint64_t created_count;
+    uint64_t finalized_count;
+    // the number of handles released with their realm or scope, whose finalizers are yet to run
+    uint64_t pending_finalizer_count;
+} realm_dart_handle_stats_t;
+
+/**
+ * Release realmPtr when handle is garbage collected. The size of the native object is measured
+ * from realmPtr and reported to the Dart GC, and counted towards the live bytes of type.
+ *
+ * @return A finalizer to pass to realm_detach_finalizer and realm_dart_update_finalizer_size.
+ */
+RLM_API void* realm_attach_finalizer(Dart_Handle handle, void* realmPtr, realm_dart_handle_type_e type);
+RLM_API void realm_detach_finalizer(void* finalizer, Dart_Handle handle);
+
+/**
+ * Measure the native object of a finalizer again, for objects that grow after they are created, such as results.
+ */
+RLM_API void realm_dart_update_finalizer_size(void* finalizer, Dart_Handle handle);
+
+/**
+ * Get the census of the handles of each of the RLM_DART_HANDLE_TYPE_COUNT handle types.
+ */
+RLM_API void realm_dart_get_handle_stats(realm_dart_handle_stats_t* out_stats);
+
+typedef struct realm_dart_child_registry realm_dart_child_registry_t;
+
+/**
+ * Create a registry of the handles to release together with a realm handle. Children are kept in levels,
+ * level 0 for the children of the realm itself and one more for each nested scope. Release it with realm_release.
+ */
+RLM_API realm_dart_child_registry_t* realm_dart_child_registry_new();
+
+/**
+ * Register the native object of finalizer, as returned by realm_attach_finalizer, at level.
+ * It is unregistered when the finalizer is detached or runs.
+ */
+RLM_API void realm_dart_child_registry_add(realm_dart_child_registry_t* registry, void* finalizer, size_t level);
+
+/**
+ * Move a registered finalizer to another level.
+ */
+RLM_API void realm_dart_child_registry_move(realm_dart_child_registry_t* registry, void* finalizer, size_t level);
+
+/**
+ * Unregister a finalizer, which keeps its native object alive until it is detached or runs.
+ */
+RLM_API void realm_dart_child_registry_remove(void* finalizer);
+
+/**
+ * Release the native objects of the children registered at level and above. Their finalizers stay attached
+ * until the Dart handles are garbage collected, but no longer hold anything.
+ */
+RLM_API void realm_dart_child_registry_release(realm_dart_child_registry_t* registry, size_t level);
 
 RLM_API void realm_set_auto_refresh(realm_t* realm, bool enable);
 
+typedef struct realm_dart_object_slab realm_dart_object_slab_t;
+
+/**
+ * Create a slab holding the objects borrowed by handles while iterating. Release it with realm_release.
+ */
+RLM_API realm_dart_object_slab_t* realm_dart_object_slab_new(size_t capacity);
+
+/**
+ * Get the object at index in results and keep it in the slab until the slab is released.
+ * The slab must have room for it.
+ *
+ * @return The object, owned by the slab, or null if an error occurred.
+ */
+RLM_API realm_object_t* realm_dart_object_slab_add_results_object(realm_dart_object_slab_t* slab, realm_results_t* results, size_t index);
+
+/**
+ * Copy the object at slot, as an object owned by the caller. The copy refers to the same object as the slab does,
+ * so it is invalid if that object was deleted, even if another object was created with the same key since.
+ *
+ * @return The object, or null if an error occurred.
+ */
+RLM_API realm_object_t* realm_dart_object_slab_promote(const realm_dart_object_slab_t* slab, size_t slot);
+
 
 
 #endif // REALM_DART_H
\ No newline at end of file
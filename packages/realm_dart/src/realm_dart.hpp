@@ -22,6 +22,11 @@
 #include <realm/object-store/c_api/types.hpp>
 #include <realm/util/functional.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+
 struct realm_dart_userdata_async {
     realm_dart_userdata_async(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler)
     : handle(Dart_NewPersistentHandle_DL(handle))
@@ -36,4 +41,47 @@ struct realm_dart_userdata_async {
     Dart_PersistentHandle handle;
     void* dart_callback;
     std::shared_ptr<realm::util::Scheduler> scheduler;
-};
\ No newline at end of file
+};
+
+// Histogram of latencies. Bucket i counts latencies below 2^i microseconds,
+// that didn't fit in bucket i - 1. Percentiles are reported as the upper bound of their bucket.
+struct LatencyHistogram {
+    static constexpr size_t bucket_count = 40;
+    std::array<std::atomic<uint64_t>, bucket_count> buckets{};
+    std::atomic<uint64_t> max_us{ 0 };
+
+    void record(uint64_t latency_us) {
+        size_t bucket = 0;
+        while (bucket < bucket_count - 1 && (uint64_t(1) << bucket) <= latency_us) {
+            ++bucket;
+        }
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        auto max = max_us.load(std::memory_order_relaxed);
+        while (latency_us > max && !max_us.compare_exchange_weak(max, latency_us, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t percentile(double p) const {
+        std::array<uint64_t, bucket_count> counts;
+        uint64_t total = 0;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            counts[i] = buckets[i].load(std::memory_order_relaxed);
+            total += counts[i];
+        }
+        if (total == 0) {
+            return 0;
+        }
+
+        const auto max = max_us.load(std::memory_order_relaxed);
+        const auto rank = static_cast<uint64_t>(p * total + 0.5);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; ++i) {
+            seen += counts[i];
+            if (seen >= rank && seen > 0) {
+                return std::min(uint64_t(1) << i, max);
+            }
+        }
+        return max;
+    }
+};
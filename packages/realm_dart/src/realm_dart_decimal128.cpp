@@ -1,7 +1,10 @@
 #include "realm_dart.hpp"
+#include "realm_dart_decimal128.h"
 #include "realm-core/src/external/IntelRDFPMathLib20U2/LIBRARY/src/bid_conf.h"
 #include "realm-core/src/external/IntelRDFPMathLib20U2/LIBRARY/src/bid_functions.h"
 
+#include <algorithm>
+
 namespace {
 realm_decimal128_t to_decimal128(const BID_UINT128& value)
 {
@@ -16,6 +19,24 @@ BID_UINT128 to_BID_UINT128(const realm_decimal128_t& value)
     memcpy(&result, &value, sizeof(BID_UINT128));
     return result;
 }
+
+// Whether value replaces result as the minimum, or maximum if max is set. NaNs never replace a number.
+bool replaces(BID_UINT128& result, BID_UINT128& value, bool max, unsigned int* flags)
+{
+    int result_is_nan;
+    bid128_isNaN(&result_is_nan, &result);
+    if (result_is_nan) {
+        return true;
+    }
+    int less;
+    if (max) {
+        bid128_quiet_less(&less, &result, &value, flags);
+    }
+    else {
+        bid128_quiet_less(&less, &value, &result, flags);
+    }
+    return less;
+}
 }
 
 RLM_API realm_decimal128_t realm_dart_decimal128_from_string(const char* string) {
@@ -26,12 +47,32 @@ RLM_API realm_decimal128_t realm_dart_decimal128_from_string(const char* string)
 }
 
 RLM_API realm_string_t realm_dart_decimal128_to_string(realm_decimal128_t x) {
+    // This buffer is reused between calls on the same thread, hence the thread_local keyword
+    thread_local char buffer[RLM_DART_DECIMAL128_STRING_BUFFER_SIZE];
+    auto length = realm_dart_decimal128_to_string_buffer(x, buffer);
+    return realm_string_t{ buffer, length };
+}
+
+RLM_API size_t realm_dart_decimal128_to_string_buffer(realm_decimal128_t x, char* buffer) {
     auto x_bid = to_BID_UINT128(x);
-    // This buffer is reused between calls, hence the static keyword
-    static char buffer[34]; // 34 bytes is the maximum length of a string representation of a decimal128
     unsigned int flags = 0;
     bid128_to_string(buffer, &x_bid, &flags);
-    return realm_string_t{ buffer, strlen(buffer) };
+    return strlen(buffer);
+}
+
+RLM_API size_t realm_dart_decimal128_to_string_batch(const realm_decimal128_t* values, size_t count, char* buffer, size_t buffer_size, uint32_t* out_ends) {
+    char value_buffer[RLM_DART_DECIMAL128_STRING_BUFFER_SIZE];
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto length = realm_dart_decimal128_to_string_buffer(values[i], value_buffer);
+        if (offset + length > buffer_size) {
+            return i;
+        }
+        memcpy(buffer + offset, value_buffer, length);
+        offset += length;
+        out_ends[i] = static_cast<uint32_t>(offset);
+    }
+    return count;
 }
 
 RLM_API realm_decimal128_t realm_dart_decimal128_nan() {
@@ -147,3 +188,83 @@ RLM_API int realm_dart_decimal128_compare_to(realm_decimal128_t x, realm_decimal
     if (rl) return 1;
     return 0;
 }
+
+RLM_API uint32_t realm_dart_decimal128_batch_binary(realm_dart_decimal128_op_e op, const realm_decimal128_t* x, const realm_decimal128_t* y, realm_decimal128_t* out, size_t count) {
+    // the flags are raised for the whole batch, not per element
+    unsigned int flags = 0;
+    for (size_t i = 0; i < count; ++i) {
+        auto l = to_BID_UINT128(x[i]);
+        auto r = to_BID_UINT128(y[i]);
+        BID_UINT128 result;
+        switch (op) {
+            case RLM_DART_DECIMAL128_OP_ADD:
+                bid128_add(&result, &l, &r, &flags);
+                break;
+            case RLM_DART_DECIMAL128_OP_SUBTRACT:
+                bid128_sub(&result, &l, &r, &flags);
+                break;
+            case RLM_DART_DECIMAL128_OP_MULTIPLY:
+                bid128_mul(&result, &l, &r, &flags);
+                break;
+            case RLM_DART_DECIMAL128_OP_DIVIDE:
+                bid128_div(&result, &l, &r, &flags);
+                break;
+        }
+        out[i] = to_decimal128(result);
+    }
+    return flags;
+}
+
+RLM_API realm_decimal128_t realm_dart_decimal128_batch_reduce(realm_dart_decimal128_reduction_e reduction, const realm_decimal128_t* values, size_t count, uint32_t* out_flags) {
+    unsigned int flags = 0;
+    BID_UINT128 result;
+    if (count == 0) {
+        if (reduction == RLM_DART_DECIMAL128_REDUCTION_SUM) {
+            BID_SINT64 zero = 0;
+            bid128_from_int64(&result, &zero);
+        }
+        else {
+            bid128_nan(&result, "+NaN");
+        }
+    }
+    else {
+        result = to_BID_UINT128(values[0]);
+        for (size_t i = 1; i < count; ++i) {
+            auto value = to_BID_UINT128(values[i]);
+            switch (reduction) {
+                case RLM_DART_DECIMAL128_REDUCTION_SUM:
+                case RLM_DART_DECIMAL128_REDUCTION_AVERAGE:
+                    bid128_add(&result, &result, &value, &flags);
+                    break;
+                case RLM_DART_DECIMAL128_REDUCTION_MIN:
+                case RLM_DART_DECIMAL128_REDUCTION_MAX:
+                    if (replaces(result, value, reduction == RLM_DART_DECIMAL128_REDUCTION_MAX, &flags)) {
+                        result = value;
+                    }
+                    break;
+            }
+        }
+        if (reduction == RLM_DART_DECIMAL128_REDUCTION_AVERAGE) {
+            BID_SINT64 n = static_cast<BID_SINT64>(count);
+            BID_UINT128 divisor;
+            bid128_from_int64(&divisor, &n);
+            bid128_div(&result, &result, &divisor, &flags);
+        }
+    }
+    if (out_flags) {
+        *out_flags = flags;
+    }
+    return to_decimal128(result);
+}
+
+RLM_API void realm_dart_decimal128_batch_compare(const realm_decimal128_t* x, const realm_decimal128_t* y, int32_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = realm_dart_decimal128_compare_to(x[i], y[i]);
+    }
+}
+
+RLM_API void realm_dart_decimal128_batch_sort(realm_decimal128_t* values, size_t count) {
+    std::sort(values, values + count, [](const realm_decimal128_t& x, const realm_decimal128_t& y) {
+        return realm_dart_decimal128_compare_to(x, y) < 0;
+    });
+}
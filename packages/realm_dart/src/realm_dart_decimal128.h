@@ -24,6 +24,27 @@
 RLM_API realm_decimal128_t realm_dart_decimal128_from_string(const char* string);
 RLM_API realm_string_t realm_dart_decimal128_to_string(realm_decimal128_t x);
 
+// Size of a buffer that fits any decimal128 formatted as a string, including the terminating zero:
+// sign, 34 digits, exponent marker, exponent sign and 4 exponent digits.
+#define RLM_DART_DECIMAL128_STRING_BUFFER_SIZE 48
+
+/**
+ * Format x into buffer, which must hold at least RLM_DART_DECIMAL128_STRING_BUFFER_SIZE bytes.
+ *
+ * @return The length of the string written to buffer, not including the terminating zero.
+ */
+RLM_API size_t realm_dart_decimal128_to_string_buffer(realm_decimal128_t x, char* buffer);
+
+/**
+ * Format count values into buffer, back to back and without terminating zeros.
+ *
+ * Value i spans from out_ends[i - 1] (or 0) to out_ends[i]. Formatting stops at the first value
+ * that doesn't fit in buffer_size bytes.
+ *
+ * @return The number of values formatted.
+ */
+RLM_API size_t realm_dart_decimal128_to_string_batch(const realm_decimal128_t* values, size_t count, char* buffer, size_t buffer_size, uint32_t* out_ends);
+
 RLM_API realm_decimal128_t realm_dart_decimal128_nan();
 RLM_API bool realm_dart_decimal128_is_nan(realm_decimal128_t x);
 RLM_API realm_decimal128_t realm_dart_decimal128_from_int64(int64_t low);
@@ -38,6 +59,45 @@ RLM_API bool realm_dart_decimal128_less_than(realm_decimal128_t x, realm_decimal
 RLM_API bool realm_dart_decimal128_greater_than(realm_decimal128_t x, realm_decimal128_t y);
 RLM_API int realm_dart_decimal128_compare_to(realm_decimal128_t x, realm_decimal128_t y);
 
+typedef enum realm_dart_decimal128_op {
+    RLM_DART_DECIMAL128_OP_ADD = 0,
+    RLM_DART_DECIMAL128_OP_SUBTRACT = 1,
+    RLM_DART_DECIMAL128_OP_MULTIPLY = 2,
+    RLM_DART_DECIMAL128_OP_DIVIDE = 3,
+} realm_dart_decimal128_op_e;
+
+typedef enum realm_dart_decimal128_reduction {
+    RLM_DART_DECIMAL128_REDUCTION_SUM = 0,
+    RLM_DART_DECIMAL128_REDUCTION_MIN = 1,
+    RLM_DART_DECIMAL128_REDUCTION_MAX = 2,
+    RLM_DART_DECIMAL128_REDUCTION_AVERAGE = 3,
+} realm_dart_decimal128_reduction_e;
+
+/**
+ * Compute out[i] = x[i] op y[i] for count elements. out may alias x or y.
+ *
+ * @return The IEEE 754 flags raised by any of the operations.
+ */
+RLM_API uint32_t realm_dart_decimal128_batch_binary(realm_dart_decimal128_op_e op, const realm_decimal128_t* x, const realm_decimal128_t* y, realm_decimal128_t* out, size_t count);
+
+/**
+ * Reduce count values to a single one. The sum of no values is zero, while their minimum, maximum and average is NaN.
+ * Minimum and maximum ignore NaNs, unless all values are NaN.
+ *
+ * @param out_flags If not null, receives the IEEE 754 flags raised by any of the operations.
+ */
+RLM_API realm_decimal128_t realm_dart_decimal128_batch_reduce(realm_dart_decimal128_reduction_e reduction, const realm_decimal128_t* values, size_t count, uint32_t* out_flags);
+
+/**
+ * Set out[i] to realm_dart_decimal128_compare_to(x[i], y[i]) for count elements.
+ */
+RLM_API void realm_dart_decimal128_batch_compare(const realm_decimal128_t* x, const realm_decimal128_t* y, int32_t* out, size_t count);
+
+/**
+ * Sort count values in place, in the total order of realm_dart_decimal128_compare_to.
+ */
+RLM_API void realm_dart_decimal128_batch_sort(realm_decimal128_t* values, size_t count);
+
 // work-around for Dart FFI issue
 RLM_API realm_decimal128_t realm_dart_decimal128_copy(realm_decimal128_t x);
 
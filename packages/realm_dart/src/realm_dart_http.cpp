@@ -0,0 +1,1010 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include <realm/sync/network/network.hpp>
+#include <realm/sync/network/network_ssl.hpp>
+#include <realm/util/logger.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "realm_dart.hpp"
+#include "realm_dart_http.h"
+
+namespace network = realm::sync::network;
+
+namespace {
+// The custom status codes reported to core, the same as reported by the Dart transport
+enum class CustomErrorCode : int {
+    no_error = 0,
+    socket_exception = 997,
+    unknown_http = 998,
+    unknown = 999,
+    timeout = 1000,
+};
+
+// Idle connections are kept per host, up to a limit, for a limited time
+constexpr size_t max_idle_connections_per_host = 4;
+constexpr std::chrono::seconds idle_timeout{ 60 };
+
+constexpr size_t max_line_length = 16 * 1024;
+constexpr size_t read_chunk_size = 16 * 1024;
+// larger responses fail instead of being read into memory, whatever their Content-Length claims
+constexpr size_t max_response_body_size = 256 * 1024 * 1024;
+
+const char* method_name(realm_http_request_method_e method) {
+    switch (method) {
+        case RLM_HTTP_REQUEST_METHOD_GET: return "GET";
+        case RLM_HTTP_REQUEST_METHOD_POST: return "POST";
+        case RLM_HTTP_REQUEST_METHOD_PATCH: return "PATCH";
+        case RLM_HTTP_REQUEST_METHOD_PUT: return "PUT";
+        case RLM_HTTP_REQUEST_METHOD_DELETE: return "DELETE";
+    }
+    return "GET";
+}
+
+// Requests that have the same effect when sent twice, so they can be sent again if the connection fails
+bool is_idempotent(realm_http_request_method_e method) {
+    switch (method) {
+        case RLM_HTTP_REQUEST_METHOD_GET:
+        case RLM_HTTP_REQUEST_METHOD_PUT:
+        case RLM_HTTP_REQUEST_METHOD_DELETE:
+            return true;
+        case RLM_HTTP_REQUEST_METHOD_POST:
+        case RLM_HTTP_REQUEST_METHOD_PATCH:
+            return false;
+    }
+    return false;
+}
+
+std::string to_lower(std::string_view str) {
+    std::string result(str);
+    std::transform(result.begin(), result.end(), result.begin(), [](unsigned char c) { return char(std::tolower(c)); });
+    return result;
+}
+
+std::string_view trim(std::string_view str) {
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.front()))) {
+        str.remove_prefix(1);
+    }
+    while (!str.empty() && std::isspace(static_cast<unsigned char>(str.back()))) {
+        str.remove_suffix(1);
+    }
+    return str;
+}
+
+struct Url {
+    bool tls = false;
+    std::string host;
+    std::string port;
+    std::string authority; // the value of the Host header
+    std::string target; // the path and query
+
+    // connections are pooled per scheme, host and port
+    std::string endpoint() const {
+        return (tls ? "https://" : "http://") + host + ":" + port;
+    }
+
+    static std::optional<Url> parse(std::string_view url) {
+        Url result;
+        if (url.substr(0, 8) == "https://") {
+            result.tls = true;
+            url.remove_prefix(8);
+        }
+        else if (url.substr(0, 7) == "http://") {
+            url.remove_prefix(7);
+        }
+        else {
+            return std::nullopt;
+        }
+
+        auto target_start = url.find_first_of("/?#");
+        auto authority = url.substr(0, target_start);
+        auto target = target_start == std::string_view::npos ? std::string_view("/") : url.substr(target_start);
+        target = target.substr(0, target.find('#'));
+        result.target = target.empty() || target.front() != '/' ? "/" + std::string(target) : std::string(target);
+
+        if (auto at = authority.rfind('@'); at != std::string_view::npos) {
+            authority.remove_prefix(at + 1);
+        }
+        result.authority = authority;
+
+        std::string_view port;
+        if (!authority.empty() && authority.front() == '[') {
+            auto close = authority.find(']');
+            if (close == std::string_view::npos) {
+                return std::nullopt;
+            }
+            result.host = authority.substr(1, close - 1);
+            port = authority.substr(close + 1);
+        }
+        else {
+            auto colon = authority.rfind(':');
+            result.host = authority.substr(0, colon);
+            port = colon == std::string_view::npos ? std::string_view() : authority.substr(colon);
+        }
+        if (!port.empty()) {
+            if (port.front() != ':') {
+                return std::nullopt;
+            }
+            port.remove_prefix(1);
+        }
+        result.port = port.empty() ? (result.tls ? "443" : "80") : std::string(port);
+
+        if (result.host.empty()) {
+            return std::nullopt;
+        }
+        return result;
+    }
+};
+
+// Segments of a path that identify a resource, such as an ObjectId, a UUID or a number,
+// rather than the route, so requests to the same route share their metrics
+bool is_id_segment(std::string_view segment) {
+    if (segment.empty()) {
+        return false;
+    }
+    const auto all_of = [&](auto predicate) {
+        return std::all_of(segment.begin(), segment.end(), [&](char c) { return predicate(static_cast<unsigned char>(c)); });
+    };
+    if (all_of(::isdigit)) {
+        return true;
+    }
+    if (segment.size() >= 16 && all_of(::isxdigit)) {
+        return true;
+    }
+    // 8-4-4-4-12
+    if (segment.size() == 36 && segment[8] == '-' && segment[13] == '-' && segment[18] == '-' && segment[23] == '-') {
+        return all_of([](unsigned char c) { return c == '-' || std::isxdigit(c); });
+    }
+    return false;
+}
+
+// The route of a url: its path without the query, with the id-like segments replaced by {id}
+std::string route_of(const char* url) {
+    auto parsed = Url::parse(url);
+    std::string_view path = parsed ? std::string_view(parsed->target) : std::string_view(url);
+    path = path.substr(0, path.find('?'));
+
+    std::string route;
+    route.reserve(path.size());
+    size_t start = 0;
+    while (start <= path.size()) {
+        const auto end = std::min(path.find('/', start), path.size());
+        const auto segment = path.substr(start, end - start);
+        route.append(is_id_segment(segment) ? "{id}" : segment);
+        if (end < path.size()) {
+            route.push_back('/');
+        }
+        start = end + 1;
+    }
+    return route;
+}
+
+uint64_t elapsed_us(std::chrono::steady_clock::time_point since) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - since).count());
+}
+
+struct HttpEndpointMetrics {
+    std::atomic<uint64_t> request_count{ 0 };
+    std::atomic<uint32_t> in_flight{ 0 };
+    std::atomic<uint64_t> timeout_count{ 0 };
+    std::atomic<uint64_t> socket_error_count{ 0 };
+    std::atomic<uint64_t> error_count{ 0 };
+    std::atomic<uint64_t> bytes_sent{ 0 };
+    std::atomic<uint64_t> bytes_received{ 0 };
+    LatencyHistogram queue;
+    LatencyHistogram first_byte;
+    LatencyHistogram latency;
+};
+
+void record_completed(HttpEndpointMetrics& endpoint, realm_dart_http_outcome_e outcome, uint64_t bytes_sent, uint64_t bytes_received,
+                      uint64_t first_byte_us, uint64_t latency_us) {
+    endpoint.request_count++;
+    switch (outcome) {
+        case RLM_DART_HTTP_OUTCOME_COMPLETED:
+            break;
+        case RLM_DART_HTTP_OUTCOME_TIMEOUT:
+            endpoint.timeout_count++;
+            break;
+        case RLM_DART_HTTP_OUTCOME_SOCKET_ERROR:
+            endpoint.socket_error_count++;
+            break;
+        case RLM_DART_HTTP_OUTCOME_ERROR:
+            endpoint.error_count++;
+            break;
+    }
+    endpoint.bytes_sent += bytes_sent;
+    endpoint.bytes_received += bytes_received;
+    endpoint.first_byte.record(first_byte_us);
+    endpoint.latency.record(latency_us);
+}
+}
+
+// The metrics of the requests of an app, by method and route. Endpoints are never removed,
+// so references to them and their paths stay valid. Once there are max_endpoints of them,
+// requests to new ones are recorded together under other_route.
+struct realm_dart_http_metrics {
+    static constexpr size_t max_endpoints = 256;
+    static constexpr const char* other_route = "{other}";
+
+    HttpEndpointMetrics& endpoint(realm_http_request_method_e method, const char* url) {
+        auto key = std::make_pair(method, route_of(url));
+        std::lock_guard lock(mutex);
+        if (auto it = endpoints.find(key); it != endpoints.end()) {
+            return it->second;
+        }
+        if (endpoints.size() >= max_endpoints) {
+            key.second = other_route;
+        }
+        return endpoints[std::move(key)];
+    }
+
+    std::mutex mutex;
+    std::map<std::pair<realm_http_request_method_e, std::string>, HttpEndpointMetrics> endpoints;
+};
+
+namespace {
+// A plain or TLS connection to a host, which outlives the requests made over it while it is kept alive
+class Connection {
+public:
+    Connection(network::Service& service, std::string endpoint)
+    : m_socket(service)
+    , m_endpoint(std::move(endpoint))
+    { }
+
+    network::Socket& socket() {
+        return m_socket;
+    }
+
+    network::ssl::Stream& start_tls(network::ssl::Context& context, const std::string& host) {
+        m_ssl_stream.emplace(m_socket, context, network::ssl::Stream::client);
+        m_ssl_stream->set_logger(realm::util::Logger::get_default_logger().get());
+        m_ssl_stream->set_host_name(host);
+        m_ssl_stream->set_verify_mode(network::ssl::VerifyMode::peer);
+        return *m_ssl_stream;
+    }
+
+    template <class H>
+    void async_write(const char* data, size_t size, H handler) {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_write(data, size, std::move(handler));
+        }
+        else {
+            m_socket.async_write(data, size, std::move(handler));
+        }
+    }
+
+    template <class H>
+    void async_read(char* buffer, size_t size, H handler) {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_read(buffer, size, m_read_ahead, std::move(handler));
+        }
+        else {
+            m_socket.async_read(buffer, size, m_read_ahead, std::move(handler));
+        }
+    }
+
+    template <class H>
+    void async_read_until(char* buffer, size_t size, char delim, H handler) {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_read_until(buffer, size, delim, m_read_ahead, std::move(handler));
+        }
+        else {
+            m_socket.async_read_until(buffer, size, delim, m_read_ahead, std::move(handler));
+        }
+    }
+
+    void close() {
+        m_socket.close();
+    }
+
+    const std::string& endpoint() const {
+        return m_endpoint;
+    }
+
+    std::chrono::steady_clock::time_point idle_since;
+
+private:
+    network::Socket m_socket;
+    std::optional<network::ssl::Stream> m_ssl_stream;
+    network::ReadAheadBuffer m_read_ahead;
+    const std::string m_endpoint;
+};
+
+class NativeHttpTransport;
+
+// A single request and its response. It is created on the calling thread and only touched on the transport thread after that.
+class Exchange : public std::enable_shared_from_this<Exchange> {
+public:
+    Exchange(NativeHttpTransport& transport, const realm_http_request_t& request, void* request_context);
+
+    void start();
+    // Fails the request if it is still running, once the service has stopped
+    void cancel();
+
+private:
+    void connect();
+    void connect_to(network::Endpoint::List endpoints, size_t index);
+    void handshake();
+    void send();
+    void read_status_line();
+    void read_header_line();
+    void read_body();
+    void read_chunk_size();
+    void read_chunk_data(size_t size);
+    void read_until_closed();
+
+    void fail(CustomErrorCode code, std::string_view what, std::error_code ec = {});
+    void record(realm_dart_http_outcome_e outcome);
+    void complete();
+    bool retry_on_stale_connection(std::error_code ec);
+    std::string_view line(size_t size);
+
+    NativeHttpTransport& m_transport;
+    HttpEndpointMetrics& m_metrics;
+    const std::chrono::steady_clock::time_point m_received_at;
+    uint64_t m_first_byte_us = 0;
+    std::optional<Url> m_url;
+    const realm_http_request_method_e m_method;
+    const std::chrono::milliseconds m_timeout;
+    std::string m_head;
+    std::string m_body;
+    void* m_request_context;
+
+    std::unique_ptr<Connection> m_connection;
+    bool m_reused_connection = false;
+    bool m_response_started = false;
+    bool m_done = false;
+    std::optional<network::Resolver> m_resolver;
+    std::optional<network::DeadlineTimer> m_timer;
+    std::unique_ptr<char[]> m_line_buffer;
+
+    int m_status_code = 0;
+    bool m_keep_alive = true;
+    bool m_chunked = false;
+    std::optional<size_t> m_content_length;
+    std::vector<std::pair<std::string, std::string>> m_response_headers;
+    std::string m_response_body;
+};
+
+class NativeHttpTransport {
+public:
+    explicit NativeHttpTransport(realm_dart_http_metrics_t* metrics)
+    : m_metrics(metrics)
+    , m_thread([this] {
+        m_ssl_context.use_default_verify();
+        m_service.run_until_stopped();
+        cancel_pending();
+        if (m_delete_on_exit) {
+            delete this;
+        }
+    })
+    { }
+
+    network::Service& service() {
+        return m_service;
+    }
+
+    realm_dart_http_metrics_t& metrics() {
+        return *m_metrics;
+    }
+
+    network::ssl::Context& ssl_context() {
+        return m_ssl_context;
+    }
+
+    // Only called on the transport thread
+    std::unique_ptr<Connection> checkout(const std::string& endpoint) {
+        auto it = m_idle.find(endpoint);
+        if (it == m_idle.end()) {
+            return nullptr;
+        }
+        auto& connections = it->second;
+        const auto now = std::chrono::steady_clock::now();
+        while (!connections.empty()) {
+            auto connection = std::move(connections.back());
+            connections.pop_back();
+            if (now - connection->idle_since < idle_timeout) {
+                return connection;
+            }
+        }
+        return nullptr;
+    }
+
+    // Only called on the transport thread
+    void checkin(std::unique_ptr<Connection> connection) {
+        connection->idle_since = std::chrono::steady_clock::now();
+        auto& connections = m_idle[connection->endpoint()];
+        connections.push_back(std::move(connection));
+        if (connections.size() > max_idle_connections_per_host) {
+            connections.erase(connections.begin());
+        }
+    }
+
+    // Only called on the transport thread
+    void finished(const Exchange& exchange) {
+        std::lock_guard lock(m_pending_mutex);
+        m_pending.erase(&exchange);
+    }
+
+    static void request(realm_userdata_t userdata, const realm_http_request_t request, void* request_context) {
+        auto transport = static_cast<NativeHttpTransport*>(userdata);
+        auto exchange = std::make_shared<Exchange>(*transport, request, request_context);
+        {
+            std::lock_guard lock(transport->m_pending_mutex);
+            transport->m_pending.emplace(exchange.get(), exchange);
+        }
+        transport->m_service.post([exchange = std::move(exchange)](realm::Status status) {
+            if (status.is_ok()) {
+                exchange->start();
+            }
+        });
+    }
+
+    static void release(realm_userdata_t userdata) {
+        auto transport = static_cast<NativeHttpTransport*>(userdata);
+        if (std::this_thread::get_id() == transport->m_thread.get_id()) {
+            // released from a completion handler, the thread deletes the transport once the service returns
+            transport->m_delete_on_exit = true;
+            transport->m_thread.detach();
+            transport->m_service.stop();
+            return;
+        }
+        transport->m_service.stop();
+        transport->m_thread.join();
+        delete transport;
+    }
+
+private:
+    // Every request must be completed, so the ones still running or queued when the transport is released
+    // are cancelled, on the transport thread once the service has stopped and before it is destroyed
+    void cancel_pending() {
+        std::map<const Exchange*, std::shared_ptr<Exchange>> pending;
+        {
+            std::lock_guard lock(m_pending_mutex);
+            pending.swap(m_pending);
+        }
+        for (auto& [_, exchange] : pending) {
+            exchange->cancel();
+        }
+        m_idle.clear();
+    }
+
+    realm_dart_http_metrics_t* const m_metrics;
+    network::Service m_service;
+    network::ssl::Context m_ssl_context;
+    std::map<std::string, std::vector<std::unique_ptr<Connection>>> m_idle;
+    std::mutex m_pending_mutex;
+    std::map<const Exchange*, std::shared_ptr<Exchange>> m_pending;
+    bool m_delete_on_exit = false;
+    std::thread m_thread; // last, so it starts when the rest is initialized
+};
+
+Exchange::Exchange(NativeHttpTransport& transport, const realm_http_request_t& request, void* request_context)
+: m_transport(transport)
+, m_metrics(transport.metrics().endpoint(request.method, request.url))
+, m_received_at(std::chrono::steady_clock::now())
+, m_url(Url::parse(request.url))
+, m_method(request.method)
+, m_timeout(request.timeout_ms)
+, m_body(request.body ? std::string(request.body, request.body_size) : std::string())
+, m_request_context(request_context)
+{
+    m_metrics.in_flight++;
+    if (!m_url) {
+        return;
+    }
+
+    m_head.reserve(256);
+    m_head.append(method_name(m_method)).append(" ").append(m_url->target).append(" HTTP/1.1\r\n");
+    bool has_host = false;
+    bool has_content_length = false;
+    for (size_t i = 0; i < request.num_headers; i++) {
+        const auto name = to_lower(request.headers[i].name);
+        has_host |= name == "host";
+        has_content_length |= name == "content-length";
+        m_head.append(request.headers[i].name).append(": ").append(request.headers[i].value).append("\r\n");
+    }
+    if (!has_host) {
+        m_head.append("Host: ").append(m_url->authority).append("\r\n");
+    }
+    if (!has_content_length && (!m_body.empty() || m_method != RLM_HTTP_REQUEST_METHOD_GET)) {
+        m_head.append("Content-Length: ").append(std::to_string(m_body.size())).append("\r\n");
+    }
+    m_head.append("\r\n");
+}
+
+void Exchange::start() {
+    m_metrics.queue.record(elapsed_us(m_received_at));
+    if (!m_url) {
+        fail(CustomErrorCode::unknown, "unsupported url");
+        return;
+    }
+
+    realm::util::Logger::get_default_logger()->debug("HTTP Transport: Executing %1 %2", method_name(m_method), m_url->endpoint() + m_url->target);
+
+    m_line_buffer = std::make_unique<char[]>(max_line_length);
+    m_timer.emplace(m_transport.service());
+    if (m_timeout.count() > 0) {
+        m_timer->async_wait(m_timeout, [self = shared_from_this()](realm::Status status) {
+            if (status.is_ok() && !self->m_done) {
+                self->fail(CustomErrorCode::timeout, "timeout");
+            }
+        });
+    }
+
+    m_connection = m_transport.checkout(m_url->endpoint());
+    m_reused_connection = m_connection != nullptr;
+    if (m_connection) {
+        send();
+    }
+    else {
+        connect();
+    }
+}
+
+void Exchange::cancel() {
+    if (!m_done) {
+        fail(CustomErrorCode::unknown, "cancelled");
+    }
+    m_timer.reset();
+    m_resolver.reset();
+}
+
+void Exchange::connect() {
+    m_connection = std::make_unique<Connection>(m_transport.service(), m_url->endpoint());
+    m_resolver.emplace(m_transport.service());
+    m_resolver->async_resolve(network::Resolver::Query(m_url->host, m_url->port),
+        [self = shared_from_this()](std::error_code ec, network::Endpoint::List endpoints) {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "resolve", ec);
+            return;
+        }
+        self->connect_to(std::move(endpoints), 0);
+    });
+}
+
+void Exchange::connect_to(network::Endpoint::List endpoints, size_t index) {
+    const network::Endpoint endpoint = *(endpoints.begin() + index);
+    m_connection->socket().async_connect(endpoint, [self = shared_from_this(), endpoints = std::move(endpoints), index](std::error_code ec) mutable {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            if (index + 1 < endpoints.size()) {
+                self->m_connection->close();
+                self->connect_to(std::move(endpoints), index + 1);
+                return;
+            }
+            self->fail(CustomErrorCode::socket_exception, "connect", ec);
+            return;
+        }
+        if (self->m_url->tls) {
+            self->handshake();
+        }
+        else {
+            self->send();
+        }
+    });
+}
+
+void Exchange::handshake() {
+    auto& stream = m_connection->start_tls(m_transport.ssl_context(), m_url->host);
+    stream.async_handshake([self = shared_from_this()](std::error_code ec) {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "TLS handshake", ec);
+            return;
+        }
+        self->send();
+    });
+}
+
+void Exchange::send() {
+    m_connection->async_write(m_head.data(), m_head.size(), [self = shared_from_this()](std::error_code ec, size_t) {
+        if (self->m_done || self->retry_on_stale_connection(ec)) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "write", ec);
+            return;
+        }
+        if (self->m_body.empty()) {
+            self->read_status_line();
+            return;
+        }
+        // the body is written as is, instead of being appended to the head
+        self->m_connection->async_write(self->m_body.data(), self->m_body.size(), [self](std::error_code ec, size_t) {
+            if (self->m_done || self->retry_on_stale_connection(ec)) {
+                return;
+            }
+            if (ec) {
+                self->fail(CustomErrorCode::socket_exception, "write", ec);
+                return;
+            }
+            self->read_status_line();
+        });
+    });
+}
+
+// A kept alive connection may have been closed by the server while it was idle. This shows as an error
+// before any of the response is read, in which case the request is sent once more on a new connection.
+// The server may have received the request before closing the connection all the same, so this is only
+// done for requests that can safely be sent twice.
+bool Exchange::retry_on_stale_connection(std::error_code ec) {
+    if (!ec || !m_reused_connection || m_response_started || !is_idempotent(m_method)) {
+        return false;
+    }
+    m_reused_connection = false;
+    m_connection->close();
+    connect();
+    return true;
+}
+
+std::string_view Exchange::line(size_t size) {
+    std::string_view result(m_line_buffer.get(), size);
+    while (!result.empty() && (result.back() == '\n' || result.back() == '\r')) {
+        result.remove_suffix(1);
+    }
+    return result;
+}
+
+void Exchange::read_status_line() {
+    m_connection->async_read_until(m_line_buffer.get(), max_line_length, '\n', [self = shared_from_this()](std::error_code ec, size_t size) {
+        if (self->m_done || self->retry_on_stale_connection(ec)) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "read", ec);
+            return;
+        }
+        self->m_response_started = true;
+        self->m_first_byte_us = elapsed_us(self->m_received_at);
+
+        // HTTP/1.1 200 OK
+        const auto status_line = self->line(size);
+        const auto first_space = status_line.find(' ');
+        if (status_line.substr(0, 5) != "HTTP/" || first_space == std::string_view::npos) {
+            self->fail(CustomErrorCode::unknown_http, "malformed status line");
+            return;
+        }
+        self->m_keep_alive = status_line.substr(0, first_space) != "HTTP/1.0";
+        self->m_status_code = std::atoi(std::string(status_line.substr(first_space + 1, 3)).c_str());
+        if (self->m_status_code < 100) {
+            self->fail(CustomErrorCode::unknown_http, "malformed status line");
+            return;
+        }
+        self->read_header_line();
+    });
+}
+
+void Exchange::read_header_line() {
+    m_connection->async_read_until(m_line_buffer.get(), max_line_length, '\n', [self = shared_from_this()](std::error_code ec, size_t size) {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "read", ec);
+            return;
+        }
+
+        const auto header_line = self->line(size);
+        if (header_line.empty()) {
+            if (self->m_status_code < 200) {
+                // an informational response, the actual one follows
+                self->m_response_headers.clear();
+                self->read_status_line();
+                return;
+            }
+            self->read_body();
+            return;
+        }
+
+        const auto colon = header_line.find(':');
+        if (colon == std::string_view::npos) {
+            self->fail(CustomErrorCode::unknown_http, "malformed header");
+            return;
+        }
+        // header names are reported in lower case, as by the Dart transport
+        auto name = to_lower(trim(header_line.substr(0, colon)));
+        auto value = std::string(trim(header_line.substr(colon + 1)));
+        if (name == "content-length") {
+            self->m_content_length = std::strtoull(value.c_str(), nullptr, 10);
+        }
+        else if (name == "transfer-encoding") {
+            self->m_chunked = to_lower(value).find("chunked") != std::string::npos;
+        }
+        else if (name == "connection") {
+            const auto connection = to_lower(value);
+            if (connection.find("close") != std::string::npos) {
+                self->m_keep_alive = false;
+            }
+            else if (connection.find("keep-alive") != std::string::npos) {
+                self->m_keep_alive = true;
+            }
+        }
+        self->m_response_headers.emplace_back(std::move(name), std::move(value));
+        self->read_header_line();
+    });
+}
+
+void Exchange::read_body() {
+    if (m_status_code == 204 || m_status_code == 304) {
+        complete();
+    }
+    else if (m_chunked) {
+        read_chunk_size();
+    }
+    else if (m_content_length) {
+        if (*m_content_length == 0) {
+            complete();
+            return;
+        }
+        if (*m_content_length > max_response_body_size) {
+            fail(CustomErrorCode::unknown_http, "response body too large");
+            return;
+        }
+        m_response_body.resize(*m_content_length);
+        m_connection->async_read(m_response_body.data(), m_response_body.size(), [self = shared_from_this()](std::error_code ec, size_t) {
+            if (self->m_done) {
+                return;
+            }
+            if (ec) {
+                self->fail(CustomErrorCode::socket_exception, "read", ec);
+                return;
+            }
+            self->complete();
+        });
+    }
+    else {
+        m_keep_alive = false;
+        read_until_closed();
+    }
+}
+
+void Exchange::read_chunk_size() {
+    m_connection->async_read_until(m_line_buffer.get(), max_line_length, '\n', [self = shared_from_this()](std::error_code ec, size_t size) {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "read", ec);
+            return;
+        }
+        const auto size_line = std::string(self->line(size));
+        char* end = nullptr;
+        const auto chunk_size = std::strtoull(size_line.c_str(), &end, 16);
+        if (end == size_line.c_str()) {
+            self->fail(CustomErrorCode::unknown_http, "malformed chunk");
+            return;
+        }
+        if (chunk_size > max_response_body_size - self->m_response_body.size()) {
+            self->fail(CustomErrorCode::unknown_http, "response body too large");
+            return;
+        }
+        self->read_chunk_data(chunk_size);
+    });
+}
+
+void Exchange::read_chunk_data(size_t size) {
+    if (size == 0) {
+        // the last chunk is followed by optional trailers and an empty line
+        m_connection->async_read_until(m_line_buffer.get(), max_line_length, '\n', [self = shared_from_this()](std::error_code ec, size_t size) {
+            if (self->m_done) {
+                return;
+            }
+            if (ec) {
+                self->fail(CustomErrorCode::socket_exception, "read", ec);
+                return;
+            }
+            if (self->line(size).empty()) {
+                self->complete();
+            }
+            else {
+                self->read_chunk_data(0);
+            }
+        });
+        return;
+    }
+
+    const auto offset = m_response_body.size();
+    m_response_body.resize(offset + size);
+    m_connection->async_read(m_response_body.data() + offset, size, [self = shared_from_this()](std::error_code ec, size_t) {
+        if (self->m_done) {
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "read", ec);
+            return;
+        }
+        // the line break ending the chunk
+        self->m_connection->async_read_until(self->m_line_buffer.get(), max_line_length, '\n', [self](std::error_code ec, size_t) {
+            if (self->m_done) {
+                return;
+            }
+            if (ec) {
+                self->fail(CustomErrorCode::socket_exception, "read", ec);
+                return;
+            }
+            self->read_chunk_size();
+        });
+    });
+}
+
+void Exchange::read_until_closed() {
+    const auto offset = m_response_body.size();
+    if (offset >= max_response_body_size) {
+        fail(CustomErrorCode::unknown_http, "response body too large");
+        return;
+    }
+    m_response_body.resize(offset + read_chunk_size);
+    m_connection->async_read(m_response_body.data() + offset, read_chunk_size, [self = shared_from_this(), offset](std::error_code ec, size_t size) {
+        if (self->m_done) {
+            return;
+        }
+        self->m_response_body.resize(offset + size);
+        if (ec == network::MiscExtErrors::end_of_input) {
+            self->complete();
+            return;
+        }
+        if (ec) {
+            self->fail(CustomErrorCode::socket_exception, "read", ec);
+            return;
+        }
+        self->read_until_closed();
+    });
+}
+
+void Exchange::fail(CustomErrorCode code, std::string_view what, std::error_code ec) {
+    m_done = true;
+    if (m_timer) {
+        m_timer->cancel();
+    }
+    if (m_connection) {
+        m_connection->close();
+        m_connection.reset();
+    }
+
+    realm::util::Logger::get_default_logger()->warn("HTTP Transport: Failed to execute %1 %2 (%3): %4", method_name(m_method),
+        m_url ? m_url->endpoint() + m_url->target : "", std::string(what), ec ? ec.message() : "");
+
+    switch (code) {
+        case CustomErrorCode::timeout:
+            record(RLM_DART_HTTP_OUTCOME_TIMEOUT);
+            break;
+        case CustomErrorCode::socket_exception:
+            record(RLM_DART_HTTP_OUTCOME_SOCKET_ERROR);
+            break;
+        default:
+            record(RLM_DART_HTTP_OUTCOME_ERROR);
+            break;
+    }
+
+    realm_http_response_t response{};
+    response.custom_status_code = static_cast<int>(code);
+    realm_http_transport_complete_request(m_request_context, &response);
+    m_transport.finished(*this);
+}
+
+void Exchange::complete() {
+    m_done = true;
+    m_timer->cancel();
+    if (m_keep_alive) {
+        m_transport.checkin(std::move(m_connection));
+    }
+    else {
+        m_connection->close();
+        m_connection.reset();
+    }
+
+    realm::util::Logger::get_default_logger()->debug("HTTP Transport: Executed %1 %2: %3", method_name(m_method), m_url->endpoint() + m_url->target, m_status_code);
+
+    record(RLM_DART_HTTP_OUTCOME_COMPLETED);
+
+    std::vector<realm_http_header_t> headers;
+    headers.reserve(m_response_headers.size());
+    for (const auto& [name, value] : m_response_headers) {
+        headers.push_back({ name.c_str(), value.c_str() });
+    }
+
+    realm_http_response_t response{};
+    response.status_code = m_status_code;
+    response.custom_status_code = static_cast<int>(CustomErrorCode::no_error);
+    response.headers = headers.data();
+    response.num_headers = headers.size();
+    response.body = m_response_body.data();
+    response.body_size = m_response_body.size();
+    realm_http_transport_complete_request(m_request_context, &response);
+    m_transport.finished(*this);
+}
+
+void Exchange::record(realm_dart_http_outcome_e outcome) {
+    m_metrics.in_flight--;
+    const auto latency_us = elapsed_us(m_received_at);
+    record_completed(m_metrics, outcome, m_body.size(), m_response_body.size(), m_response_started ? m_first_byte_us : latency_us, latency_us);
+}
+}
+
+RLM_API realm_dart_http_metrics_t* realm_dart_http_metrics_get(const char* app_id) {
+    static std::mutex mutex;
+    static auto& registry = *new std::map<std::string, realm_dart_http_metrics>();
+    std::lock_guard lock(mutex);
+    return &registry[app_id];
+}
+
+RLM_API void realm_dart_http_metrics_request_started(realm_dart_http_metrics_t* metrics, realm_http_request_method_e method, const char* url) {
+    metrics->endpoint(method, url).in_flight++;
+}
+
+RLM_API void realm_dart_http_metrics_request_completed(realm_dart_http_metrics_t* metrics, realm_http_request_method_e method, const char* url,
+                                                       realm_dart_http_outcome_e outcome, uint64_t bytes_sent, uint64_t bytes_received,
+                                                       uint64_t queue_us, uint64_t first_byte_us, uint64_t latency_us) {
+    auto& endpoint = metrics->endpoint(method, url);
+    endpoint.in_flight--;
+    endpoint.queue.record(queue_us);
+    record_completed(endpoint, outcome, bytes_sent, bytes_received, first_byte_us, latency_us);
+}
+
+RLM_API size_t realm_dart_http_metrics_get_endpoints(realm_dart_http_metrics_t* metrics, realm_dart_http_endpoint_metrics_t* out_endpoints, size_t capacity) {
+    std::lock_guard lock(metrics->mutex);
+    size_t i = 0;
+    for (auto it = metrics->endpoints.begin(); it != metrics->endpoints.end() && i < capacity; ++it, ++i) {
+        const auto& [key, endpoint] = *it;
+        auto& out = out_endpoints[i];
+        out.method = key.first;
+        out.path = key.second.c_str();
+        out.request_count = endpoint.request_count.load(std::memory_order_relaxed);
+        out.in_flight = endpoint.in_flight.load(std::memory_order_relaxed);
+        out.timeout_count = endpoint.timeout_count.load(std::memory_order_relaxed);
+        out.socket_error_count = endpoint.socket_error_count.load(std::memory_order_relaxed);
+        out.error_count = endpoint.error_count.load(std::memory_order_relaxed);
+        out.bytes_sent = endpoint.bytes_sent.load(std::memory_order_relaxed);
+        out.bytes_received = endpoint.bytes_received.load(std::memory_order_relaxed);
+        out.queue_p50_us = endpoint.queue.percentile(0.50);
+        out.queue_p99_us = endpoint.queue.percentile(0.99);
+        out.queue_max_us = endpoint.queue.max_us.load(std::memory_order_relaxed);
+        out.first_byte_p50_us = endpoint.first_byte.percentile(0.50);
+        out.first_byte_p99_us = endpoint.first_byte.percentile(0.99);
+        out.first_byte_max_us = endpoint.first_byte.max_us.load(std::memory_order_relaxed);
+        out.latency_p50_us = endpoint.latency.percentile(0.50);
+        out.latency_p99_us = endpoint.latency.percentile(0.99);
+        out.latency_max_us = endpoint.latency.max_us.load(std::memory_order_relaxed);
+    }
+    return metrics->endpoints.size();
+}
+
+RLM_API realm_http_transport_t* realm_dart_native_http_transport_new(realm_dart_http_metrics_t* metrics) {
+    return realm_http_transport_new(NativeHttpTransport::request, new NativeHttpTransport(metrics), NativeHttpTransport::release);
+}
@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2024 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <realm.h>
+#include "realm_dart.h"
+
+typedef enum realm_dart_http_outcome {
+    // a response was received, whatever its status code
+    RLM_DART_HTTP_OUTCOME_COMPLETED = 0,
+    RLM_DART_HTTP_OUTCOME_TIMEOUT = 1,
+    RLM_DART_HTTP_OUTCOME_SOCKET_ERROR = 2,
+    RLM_DART_HTTP_OUTCOME_ERROR = 3,
+} realm_dart_http_outcome_e;
+
+typedef struct realm_dart_http_metrics realm_dart_http_metrics_t;
+
+typedef struct realm_dart_http_endpoint_metrics {
+    // the method and the route of the requests: their path without the query, with segments that look like ids,
+    // such as ObjectIds, UUIDs and numbers, replaced by {id}. Requests beyond the first 256 routes share the route {other}.
+    realm_http_request_method_e method;
+    const char* path;
+    // the number of requests that completed, timed out or failed, and the number still running
+    uint64_t request_count;
+    uint32_t in_flight;
+    uint64_t timeout_count;
+    uint64_t socket_error_count;
+    uint64_t error_count;
+    // the size of the request and response bodies
+    uint64_t bytes_sent;
+    uint64_t bytes_received;
+    // time from the transport receiving a request until it starts executing it. For the Dart transport
+    // this is the time waiting for the isolate. Percentiles are rounded up to the next power of two.
+    uint64_t queue_p50_us;
+    uint64_t queue_p99_us;
+    uint64_t queue_max_us;
+    // time from the transport receiving a request until the response headers are received
+    uint64_t first_byte_p50_us;
+    uint64_t first_byte_p99_us;
+    uint64_t first_byte_max_us;
+    // time from the transport receiving a request until the whole response is received
+    uint64_t latency_p50_us;
+    uint64_t latency_p99_us;
+    uint64_t latency_max_us;
+} realm_dart_http_endpoint_metrics_t;
+
+/**
+ * Get the HTTP metrics of an app. They are shared by all isolates and never freed.
+ */
+RLM_API realm_dart_http_metrics_t* realm_dart_http_metrics_get(const char* app_id);
+
+/**
+ * Record that a request to url was started. Every started request must be completed.
+ */
+RLM_API void realm_dart_http_metrics_request_started(realm_dart_http_metrics_t* metrics, realm_http_request_method_e method, const char* url);
+
+/**
+ * Record the outcome and timings of a request to url.
+ */
+RLM_API void realm_dart_http_metrics_request_completed(realm_dart_http_metrics_t* metrics, realm_http_request_method_e method, const char* url,
+                                                       realm_dart_http_outcome_e outcome, uint64_t bytes_sent, uint64_t bytes_received,
+                                                       uint64_t queue_us, uint64_t first_byte_us, uint64_t latency_us);
+
+/**
+ * Copy the metrics of up to capacity endpoints to out_endpoints. Returns the number of endpoints with metrics,
+ * which may be more than capacity. The paths remain valid for the lifetime of the process.
+ */
+RLM_API size_t realm_dart_http_metrics_get_endpoints(realm_dart_http_metrics_t* metrics, realm_dart_http_endpoint_metrics_t* out_endpoints, size_t capacity);
+
+/**
+ * Create an HTTP transport that performs the requests of an app natively, on a thread of its own,
+ * without involving any isolate. Connections are kept alive and reused for requests to the same host.
+ */
+RLM_API realm_http_transport_t* realm_dart_native_http_transport_new(realm_dart_http_metrics_t* metrics);
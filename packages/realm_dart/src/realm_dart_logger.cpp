@@ -17,37 +17,105 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <condition_variable>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <sstream>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 #include <realm/object-store/c_api/util.hpp>
+#include <realm/util/assert.hpp>
+#include <realm/util/file.hpp>
 
 #include "realm_dart_logger.h"
 
 using namespace realm::util;
 
-bool send_message_to_scheduler(Dart_Port port, const char* category, realm_log_level_e level, const char* message) {
-    Dart_CObject c_category;
-    c_category.type = Dart_CObject_kString;
-    c_category.value.as_string = const_cast<char*>(category);
+// Log records encoded as a single message for the scheduler of an isolate. The message is an array of typed data:
+//   [levels (Uint8List), category ids (Uint16List), message end offsets (Uint32List), messages (UTF-8, Uint8List)]
+// where category ids index into realm_get_category_names, and message i spans from the end of message i - 1 to end i.
+class LogBatch {
+public:
+    void add(uint16_t category_id, realm_log_level_e level, std::string_view message) {
+        m_levels.push_back(static_cast<uint8_t>(level));
+        m_category_ids.push_back(category_id);
+        m_text.append(message);
+        m_message_ends.push_back(static_cast<uint32_t>(m_text.size()));
+    }
+
+    bool empty() const {
+        return m_levels.empty();
+    }
+
+    void clear() {
+        m_levels.clear();
+        m_category_ids.clear();
+        m_message_ends.clear();
+        m_text.clear();
+    }
 
-    Dart_CObject c_level;
-    c_level.type = Dart_CObject_kInt32;
-    c_level.value.as_int32 = level;
+    bool post(Dart_Port port) const {
+        Dart_CObject c_levels = typed_data(Dart_TypedData_kUint8, m_levels.size(), m_levels.data());
+        Dart_CObject c_category_ids = typed_data(Dart_TypedData_kUint16, m_category_ids.size(), m_category_ids.data());
+        Dart_CObject c_message_ends = typed_data(Dart_TypedData_kUint32, m_message_ends.size(), m_message_ends.data());
+        Dart_CObject c_text = typed_data(Dart_TypedData_kUint8, m_text.size(), m_text.data());
 
-    Dart_CObject c_message;
-    c_message.type = Dart_CObject_kString;
-    c_message.value.as_string = const_cast<char*>(message);
+        Dart_CObject* c_request_arr[] = { &c_levels, &c_category_ids, &c_message_ends, &c_text };
+        Dart_CObject c_request;
+        c_request.type = Dart_CObject_kArray;
+        c_request.value.as_array.values = c_request_arr;
+        c_request.value.as_array.length = sizeof(c_request_arr) / sizeof(c_request_arr[0]);
+
+        return Dart_PostCObject_DL(port, &c_request);
+    }
+
+private:
+    // length is in elements, not bytes. The data is copied when posted.
+    static Dart_CObject typed_data(Dart_TypedData_Type type, size_t length, const void* values) {
+        Dart_CObject c_typed_data;
+        c_typed_data.type = Dart_CObject_kTypedData;
+        c_typed_data.value.as_typed_data.type = type;
+        c_typed_data.value.as_typed_data.length = static_cast<intptr_t>(length);
+        c_typed_data.value.as_typed_data.values = static_cast<const uint8_t*>(values);
+        return c_typed_data;
+    }
 
-    Dart_CObject* c_request_arr[] = { &c_category, &c_level, &c_message };
-    Dart_CObject c_request;
-    c_request.type = Dart_CObject_kArray;
-    c_request.value.as_array.values = c_request_arr;
-    c_request.value.as_array.length = sizeof(c_request_arr) / sizeof(c_request_arr[0]);
+    std::vector<uint8_t> m_levels;
+    std::vector<uint16_t> m_category_ids;
+    std::vector<uint32_t> m_message_ends;
+    std::string m_text;
+};
 
-    return Dart_PostCObject_DL(port, &c_request);
+// Category names by id, in the order of realm_get_category_names
+const std::vector<std::string>& log_category_names() {
+    static const std::vector<std::string> names = [] {
+        auto names = LogCategory::get_category_names();
+        return std::vector<std::string>(names.begin(), names.end());
+    }();
+    return names;
+}
+
+uint16_t log_category_id(std::string_view category) {
+    static const std::map<std::string_view, uint16_t> ids = [] {
+        std::map<std::string_view, uint16_t> ids;
+        const auto& names = log_category_names();
+        for (size_t i = 0; i < names.size(); ++i) {
+            ids.emplace(names[i], static_cast<uint16_t>(i));
+        }
+        return ids;
+    }();
+    auto it = ids.find(category);
+    return it != ids.end() ? it->second : ids.at("Realm");
 }
 
 std::mutex dart_logger_mutex;
@@ -55,6 +123,295 @@ std::set<Dart_Port> dart_send_ports;
 std::shared_ptr<StderrLogger> default_debug_logger;
 bool default_debug_logger_initialized = false;
 
+// Writes log records as lines of text to a memory mapped file of a fixed size. When the file is full it is renamed
+// to path.1, path.1 to path.2 and so on, and a new file is started. At most max_file_count files are kept.
+class FileLogSink {
+public:
+    FileLogSink(std::string path, size_t max_file_size, size_t max_file_count)
+        : m_path(std::move(path))
+        , m_max_file_size(max_file_size)
+        , m_max_file_count(std::max<size_t>(max_file_count, 1))
+    {
+        rotate();
+    }
+
+    ~FileLogSink() {
+        try {
+            close();
+        }
+        catch (...) {
+        }
+    }
+
+    void write(std::string_view category, realm_log_level_e level, std::string_view message) {
+        using namespace std::chrono;
+        const auto now = system_clock::now();
+        const auto time = system_clock::to_time_t(now);
+        const auto millis = duration_cast<milliseconds>(now.time_since_epoch()).count() % 1000;
+        char timestamp[32];
+        // only ever called on the flusher thread, so the static buffer of gmtime is fine
+        auto length = std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", std::gmtime(&time));
+        std::snprintf(timestamp + length, sizeof(timestamp) - length, ".%03dZ ", static_cast<int>(millis));
+
+        m_line.assign(timestamp);
+        m_line.append(category).append(" ").append(Logger::level_to_string(Logger::Level(level))).append(": ");
+        m_line.append(message).append("\n");
+
+        if (m_offset + m_line.size() > m_max_file_size) {
+            rotate();
+        }
+        // a single record larger than a file is cut short
+        const auto size = std::min(m_line.size(), m_max_file_size - m_offset);
+        std::memcpy(m_map.get_addr() + m_offset, m_line.data(), size);
+        m_offset += size;
+    }
+
+private:
+    std::string file_name(size_t index) const {
+        return index == 0 ? m_path : m_path + "." + std::to_string(index);
+    }
+
+    void close() {
+        if (m_file.is_attached()) {
+            m_map.unmap();
+            // drop the unused tail of the mapping
+            m_file.resize(m_offset);
+            m_file.close();
+        }
+    }
+
+    void rotate() {
+        close();
+        File::try_remove(file_name(m_max_file_count - 1));
+        for (size_t i = m_max_file_count - 1; i > 0; --i) {
+            if (File::exists(file_name(i - 1))) {
+                File::move(file_name(i - 1), file_name(i));
+            }
+        }
+
+        m_file.open(m_path, File::mode_Write);
+        m_file.resize(m_max_file_size);
+        m_map.map(m_file, File::access_ReadWrite, m_max_file_size);
+        m_offset = 0;
+    }
+
+    const std::string m_path;
+    const size_t m_max_file_size;
+    const size_t m_max_file_count;
+
+    File m_file;
+    File::Map<char> m_map;
+    size_t m_offset = 0;
+    std::string m_line;
+};
+
+// Level thresholds set with realm_dart_set_log_filter, per port and category. A threshold applies to its category and
+// all subcategories, unless a subcategory has its own. Ports without a threshold for a category receive all its messages
+// that core emits.
+using CategoryLevels = std::map<std::string, realm_log_level_e, std::less<>>;
+std::map<Dart_Port, CategoryLevels> dart_log_filters;
+
+// The file sink attached with realm_dart_attach_file_log_sink, and its thresholds
+std::unique_ptr<FileLogSink> file_log_sink;
+CategoryLevels file_log_filters;
+
+// like core, setting a category overrides the thresholds of its subcategories
+void set_log_threshold(CategoryLevels& levels, const char* category, realm_log_level_e level) {
+    const std::string prefix = std::string(category) + ".";
+    for (auto it = levels.lower_bound(prefix); it != levels.end() && it->first.compare(0, prefix.size(), prefix) == 0;) {
+        it = levels.erase(it);
+    }
+    levels[category] = level;
+}
+
+std::optional<realm_log_level_e> find_log_threshold(const CategoryLevels& levels, std::string_view category) {
+    while (true) {
+        auto it = levels.find(category);
+        if (it != levels.end()) {
+            return it->second;
+        }
+        auto dot = category.rfind('.');
+        if (dot == std::string_view::npos) {
+            return std::nullopt;
+        }
+        category = category.substr(0, dot);
+    }
+}
+
+void uninstall_logger_callback();
+
+// Immutable snapshot of the filters of the attached ports and file sink, so core threads can check them without locking.
+struct LogFilters {
+    std::map<Dart_Port, CategoryLevels> port_levels;
+    CategoryLevels file_levels;
+    // lowest threshold per category over all sinks, for the categories all sinks filter
+    CategoryLevels min_levels;
+
+    bool is_wanted(std::string_view category, realm_log_level_e level) const {
+        auto it = min_levels.find(category);
+        return it == min_levels.end() || level >= it->second;
+    }
+
+    bool is_wanted(Dart_Port port, std::string_view category, realm_log_level_e level) const {
+        auto it = port_levels.find(port);
+        if (it == port_levels.end()) {
+            return true;
+        }
+        auto threshold = find_log_threshold(it->second, category);
+        return !threshold || level >= *threshold;
+    }
+
+    bool is_wanted_by_file(std::string_view category, realm_log_level_e level) const {
+        auto threshold = find_log_threshold(file_levels, category);
+        return !threshold || level >= *threshold;
+    }
+};
+
+// The current snapshot, read by core threads without locking. Replaced snapshots are retired and only deleted once
+// no reader is inside one, so readers pay two uncontended atomic increments rather than a lock.
+std::atomic<const LogFilters*> dart_attached_log_filters{ new LogFilters() };
+std::atomic<uint32_t> log_filter_readers{ 0 };
+std::vector<const LogFilters*> retired_log_filters; // guarded by dart_logger_mutex
+
+// Reads the current snapshot on any thread
+class LogFiltersReader {
+public:
+    LogFiltersReader() {
+        log_filter_readers.fetch_add(1, std::memory_order_seq_cst);
+        m_filters = dart_attached_log_filters.load(std::memory_order_seq_cst);
+    }
+
+    ~LogFiltersReader() {
+        log_filter_readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    const LogFilters* operator->() const {
+        return m_filters;
+    }
+
+private:
+    const LogFilters* m_filters;
+};
+
+// Must be called with dart_logger_mutex held
+void reclaim_log_filters() {
+    // a reader that comes in after this check loads the current snapshot, which is never retired here
+    if (!retired_log_filters.empty() && log_filter_readers.load(std::memory_order_seq_cst) == 0) {
+        for (auto filters : retired_log_filters) {
+            delete filters;
+        }
+        retired_log_filters.clear();
+    }
+}
+
+// The levels of the categories in core before any sink set a threshold, restored once no sink has one
+const std::map<std::string, realm_log_level_e, std::less<>>& core_default_log_levels() {
+    static const auto levels = [] {
+        std::map<std::string, realm_log_level_e, std::less<>> levels;
+        for (auto name : LogCategory::get_category_names()) {
+            levels.emplace(name, realm_get_log_level_category(name));
+        }
+        return levels;
+    }();
+    return levels;
+}
+
+// parents sort before their subcategories
+std::vector<std::string> sorted_category_names() {
+    auto names = LogCategory::get_category_names();
+    std::vector<std::string> sorted(names.begin(), names.end());
+    std::sort(sorted.begin(), sorted.end());
+    return sorted;
+}
+
+// Must be called with dart_logger_mutex held
+void publish_log_filters() {
+    auto filters = std::make_unique<LogFilters>();
+    std::vector<const CategoryLevels*> sinks;
+    for (auto port : dart_send_ports) {
+        auto it = dart_log_filters.find(port);
+        if (it != dart_log_filters.end()) {
+            sinks.push_back(&filters->port_levels.emplace(port, it->second).first->second);
+        }
+        else {
+            sinks.push_back(nullptr);
+        }
+    }
+    if (file_log_sink) {
+        filters->file_levels = file_log_filters;
+        sinks.push_back(&filters->file_levels);
+    }
+
+    // A message can only be dropped before it is queued, if every sink filters its category
+    if (!sinks.empty() && std::find(sinks.begin(), sinks.end(), nullptr) == sinks.end()) {
+        for (const auto& name : sorted_category_names()) {
+            std::optional<realm_log_level_e> min_level = RLM_LOG_LEVEL_OFF;
+            for (auto levels : sinks) {
+                auto threshold = find_log_threshold(*levels, name);
+                min_level = threshold && min_level ? std::min(*min_level, *threshold) : std::nullopt;
+            }
+            if (min_level) {
+                filters->min_levels.emplace(name, *min_level);
+            }
+        }
+    }
+    retired_log_filters.push_back(dart_attached_log_filters.exchange(filters.release(), std::memory_order_seq_cst));
+    reclaim_log_filters();
+}
+
+// Must be called with dart_logger_mutex held.
+// Core only formats the messages some sink asked for, so set its thresholds to the lowest one of the sinks, and back
+// to its own default for the categories no sink has a threshold for. An attached port without a threshold for a
+// category counts with that default, so a higher threshold set by one isolate doesn't hide the messages another one
+// gets by default. Levels are recomputed from scratch, so they go up again when a sink goes away.
+void apply_log_filters_to_core() {
+    const auto& default_levels = core_default_log_levels();
+    std::vector<const CategoryLevels*> sinks;
+    for (const auto& [port, levels] : dart_log_filters) {
+        sinks.push_back(&levels);
+    }
+    if (file_log_sink) {
+        sinks.push_back(&file_log_filters);
+    }
+    std::vector<const CategoryLevels*> port_sinks;
+    for (auto port : dart_send_ports) {
+        auto it = dart_log_filters.find(port);
+        port_sinks.push_back(it != dart_log_filters.end() ? &it->second : nullptr);
+    }
+
+    // setting a parent resets its subcategories, so go parents first
+    for (const auto& name : sorted_category_names()) {
+        auto default_level = default_levels.find(name);
+        std::optional<realm_log_level_e> min_level;
+        for (auto levels : sinks) {
+            if (auto threshold = find_log_threshold(*levels, name)) {
+                min_level = min_level ? std::min(*min_level, *threshold) : *threshold;
+            }
+        }
+        if (default_level != default_levels.end()) {
+            bool port_without_threshold = std::any_of(port_sinks.begin(), port_sinks.end(), [&](auto levels) {
+                return !levels || !find_log_threshold(*levels, name);
+            });
+            if (!min_level || port_without_threshold) {
+                min_level = min_level ? std::min(*min_level, default_level->second) : default_level->second;
+            }
+        }
+        if (min_level) {
+            realm_set_log_level_category(name.c_str(), *min_level);
+        }
+    }
+}
+
+// Must be called with dart_logger_mutex held.
+void remove_dart_log_port(Dart_Port port) {
+    dart_send_ports.erase(port);
+    uninstall_logger_callback();
+    // The isolate sets its filters again if it attaches again
+    dart_log_filters.erase(port);
+    apply_log_filters_to_core();
+    publish_log_filters();
+}
+
 RLM_API void realm_dart_init_debug_logger() {
     if (default_debug_logger_initialized) {
         return;
@@ -64,28 +421,308 @@ RLM_API void realm_dart_init_debug_logger() {
     default_debug_logger_initialized = true;
 }
 
+struct LogRecord {
+    uint16_t category_id;
+    realm_log_level_e level;
+    std::string message;
+};
+
+// Bounded multi-producer single-consumer queue of log records, after Dmitry Vyukov's bounded MPMC queue.
+// Producers claim a slot with a single CAS and never wait for each other or for the consumer. When the
+// queue is full the record is dropped.
+class LogRingBuffer {
+public:
+    explicit LogRingBuffer(size_t capacity)
+        : m_slots(new Slot[capacity])
+        , m_mask(capacity - 1)
+    {
+        REALM_ASSERT((capacity & m_mask) == 0);
+        for (size_t i = 0; i < capacity; ++i) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    //This can be invoked on any thread
+    bool try_push(uint16_t category_id, realm_log_level_e level, const char* message) {
+        Slot* slot;
+        size_t pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            slot = &m_slots[pos & m_mask];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            }
+            else if (diff < 0) {
+                return false;
+            }
+            else {
+                pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->record.category_id = category_id;
+        slot->record.level = level;
+        slot->record.message.assign(message);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    //This must only be invoked on the flusher thread
+    bool try_pop(LogRecord& out) {
+        Slot& slot = m_slots[m_dequeue_pos & m_mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_dequeue_pos + 1) < 0) {
+            return false;
+        }
+
+        // swap rather than move, so the slot keeps the string buffers for the next producer
+        std::swap(out, slot.record);
+        slot.sequence.store(m_dequeue_pos + m_mask + 1, std::memory_order_release);
+        ++m_dequeue_pos;
+        return true;
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    const size_t m_mask;
+    std::atomic<size_t> m_enqueue_pos{ 0 };
+    size_t m_dequeue_pos = 0;
+};
+
+// Drains the ring buffer on a background thread and posts the records to the attached ports. Core threads only
+// ever touch the ring buffer, so logging never blocks them, no matter how many isolates are listening.
+// There is a single flusher per process. It is never destroyed, as core may log during shutdown.
+void detach_file_log_sink();
+
+class LogFlusher {
+public:
+    static constexpr size_t capacity = 8192;
+    // records are posted to the isolates in batches of at most this many records,
+    static constexpr size_t batch_size = 256;
+    // and delayed at most this long to fill a batch
+    static constexpr std::chrono::milliseconds flush_interval{ 10 };
+
+    static LogFlusher& get() {
+        static LogFlusher* flusher = new LogFlusher();
+        return *flusher;
+    }
+
+    //This can be invoked on any thread
+    void log(std::string_view category, realm_log_level_e level, const char* message) {
+        if (!m_records.try_push(log_category_id(category), level, message)) {
+            m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto pending = m_pending_count.fetch_add(1, std::memory_order_acq_rel) + 1;
+        if (pending == 1 || pending == batch_size) {
+            // A wake-up racing with the flusher going to sleep is picked up by its timed wait
+            m_cv.notify_one();
+        }
+    }
+
+    uint64_t dropped_count() const {
+        return m_dropped_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    LogFlusher() : m_records(capacity) {
+        std::thread([this] { run(); }).detach();
+    }
+
+    void run() {
+        using namespace std::chrono_literals;
+        std::vector<LogRecord> records(batch_size);
+        LogBatch batch;
+        uint64_t reported_dropped_count = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cv.wait_for(lock, 50ms, [this] { return m_pending_count.load(std::memory_order_acquire) > 0; });
+                m_cv.wait_for(lock, flush_interval, [this] { return m_pending_count.load(std::memory_order_acquire) >= batch_size; });
+            }
+
+            while (true) {
+                size_t count = 0;
+                while (count < records.size() && m_records.try_pop(records[count])) {
+                    ++count;
+                }
+                m_pending_count.fetch_sub(count, std::memory_order_acq_rel);
+
+                std::string dropped_message;
+                auto dropped = m_dropped_count.load(std::memory_order_relaxed);
+                if (count < records.size() && dropped != reported_dropped_count) {
+                    std::stringstream ss;
+                    ss << (dropped - reported_dropped_count) << " log messages were dropped, because they were logged faster than they could be delivered.";
+                    dropped_message = ss.str();
+                    reported_dropped_count = dropped;
+                }
+                if (count == 0 && dropped_message.empty()) {
+                    break;
+                }
+
+                std::lock_guard<std::mutex> lock(dart_logger_mutex);
+                reclaim_log_filters();
+                // writers hold the mutex too, so the snapshot can't be retired while in use here
+                auto filters = dart_attached_log_filters.load(std::memory_order_acquire);
+                const auto& category_names = log_category_names();
+                std::vector<Dart_Port> closed_ports;
+                for (auto port : dart_send_ports) {
+                    for (size_t i = 0; i < count; ++i) {
+                        const auto& record = records[i];
+                        if (filters->is_wanted(port, category_names[record.category_id], record.level)) {
+                            batch.add(record.category_id, record.level, record.message);
+                        }
+                    }
+                    if (!dropped_message.empty()) {
+                        batch.add(log_category_id("Realm.SDK"), RLM_LOG_LEVEL_WARNING, dropped_message);
+                    }
+                    if (!batch.empty()) {
+                        if (!batch.post(port)) {
+                            closed_ports.push_back(port);
+                        }
+                        batch.clear();
+                    }
+                }
+                // the isolate of a closed port is gone without detaching, so drop it and its thresholds
+                for (auto port : closed_ports) {
+                    remove_dart_log_port(port);
+                }
+                if (!closed_ports.empty()) {
+                    filters = dart_attached_log_filters.load(std::memory_order_acquire);
+                }
+
+                if (file_log_sink) {
+                    try {
+                        for (size_t i = 0; i < count; ++i) {
+                            const auto& record = records[i];
+                            const auto& category = category_names[record.category_id];
+                            if (filters->is_wanted_by_file(category, record.level)) {
+                                file_log_sink->write(category, record.level, record.message);
+                            }
+                        }
+                        if (!dropped_message.empty()) {
+                            file_log_sink->write("Realm.SDK", RLM_LOG_LEVEL_WARNING, dropped_message);
+                        }
+                    }
+                    catch (const std::exception& e) {
+                        std::fprintf(stderr, "Detaching the file log sink after failing to write to it: %s\n", e.what());
+                        detach_file_log_sink();
+                    }
+                }
+            }
+        }
+    }
+
+    LogRingBuffer m_records;
+    std::atomic<size_t> m_pending_count{ 0 };
+    std::atomic<uint64_t> m_dropped_count{ 0 };
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+};
+
+void realm_dart_logger_callback(realm_userdata_t userData, const char* category, realm_log_level_e level, const char* message);
+
+// Must be called with dart_logger_mutex held, before adding the first sink
+void install_logger_callback() {
+    if (dart_send_ports.empty() && !file_log_sink) {
+        realm_set_log_callback(realm_dart_logger_callback, nullptr, nullptr);
+    }
+}
+
+// Must be called with dart_logger_mutex held, after removing a sink
+void uninstall_logger_callback() {
+    if (dart_send_ports.empty() && !file_log_sink) {
+        Logger::set_default_logger(default_debug_logger);
+    }
+}
+
+// Must be called with dart_logger_mutex held
+void detach_file_log_sink() {
+    if (!file_log_sink) {
+        return;
+    }
+    file_log_sink.reset();
+    file_log_filters.clear();
+    uninstall_logger_callback();
+    apply_log_filters_to_core();
+    publish_log_filters();
+}
+
 void realm_dart_logger_callback(realm_userdata_t userData, const char* category, realm_log_level_e level, const char* message) {
-    std::lock_guard<std::mutex> lock(dart_logger_mutex);
-    for (auto itr = dart_send_ports.begin(); itr != dart_send_ports.end(); ++itr) {
-        Dart_Port port = *itr;
-        send_message_to_scheduler(port, category, level, message);
+    // Nobody listens to this message, so don't bother queueing it
+    if (!LogFiltersReader()->is_wanted(category, level)) {
+        return;
     }
+    LogFlusher::get().log(category, level, message);
 }
 
 RLM_API void realm_dart_attach_logger(Dart_Port port) {
     std::lock_guard<std::mutex> lock(dart_logger_mutex);
-    if (dart_send_ports.empty()) {
-        realm_set_log_callback(realm_dart_logger_callback, nullptr, nullptr);
-    }
+    install_logger_callback();
     dart_send_ports.insert(port);
+    apply_log_filters_to_core();
+    publish_log_filters();
 }
 
 RLM_API void realm_dart_detach_logger(Dart_Port port) {
     std::lock_guard<std::mutex> lock(dart_logger_mutex);
-    dart_send_ports.erase(port);
-    if (dart_send_ports.empty()) {
-        Logger::set_default_logger(default_debug_logger);
-    }
+    remove_dart_log_port(port);
+}
+
+RLM_API void realm_dart_set_log_filter(Dart_Port port, const char* category, realm_log_level_e level) {
+    std::lock_guard<std::mutex> lock(dart_logger_mutex);
+    set_log_threshold(dart_log_filters[port], category, level);
+    apply_log_filters_to_core();
+    publish_log_filters();
+}
+
+RLM_API bool realm_dart_attach_file_log_sink(const char* path, uint64_t max_file_size, uint32_t max_file_count,
+                                             const char** categories, const realm_log_level_e* levels, size_t levels_count) {
+    return realm::c_api::wrap_err([&] {
+        // setting a category overrides its subcategories, so set parents first
+        std::vector<std::pair<std::string_view, realm_log_level_e>> sorted_levels;
+        for (size_t i = 0; i < levels_count; ++i) {
+            sorted_levels.emplace_back(categories[i], levels[i]);
+        }
+        std::stable_sort(sorted_levels.begin(), sorted_levels.end(), [](const auto& a, const auto& b) {
+            return a.first.size() < b.first.size();
+        });
+        CategoryLevels filters;
+        for (const auto& [category, level] : sorted_levels) {
+            set_log_threshold(filters, std::string(category).c_str(), level);
+        }
+
+        // The new sink rotates the files as it is created, which may be those of the current sink, so the current sink
+        // is closed first and the files are only touched with the mutex held, like the flusher does when writing.
+        std::lock_guard<std::mutex> lock(dart_logger_mutex);
+        detach_file_log_sink();
+        auto sink = std::make_unique<FileLogSink>(path, static_cast<size_t>(max_file_size), max_file_count);
+        install_logger_callback();
+        // the filters are published together with the sink, so it never sees a record they filter out
+        file_log_filters = std::move(filters);
+        file_log_sink = std::move(sink);
+        apply_log_filters_to_core();
+        publish_log_filters();
+        return true;
+    });
+}
+
+RLM_API void realm_dart_detach_file_log_sink() {
+    std::lock_guard<std::mutex> lock(dart_logger_mutex);
+    detach_file_log_sink();
+}
+
+RLM_API uint64_t realm_dart_logger_get_dropped_count() {
+    return LogFlusher::get().dropped_count();
 }
 
 RLM_API void realm_dart_log(realm_log_level_e level, const char* category, const char* message) {
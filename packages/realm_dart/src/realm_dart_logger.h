@@ -28,6 +28,38 @@ RLM_API void realm_dart_attach_logger(Dart_Port port);
 
 RLM_API void realm_dart_detach_logger(Dart_Port port);
 
+/**
+ * Only deliver messages of category, and its subcategories, with at least the given level to port.
+ *
+ * Messages no attached port wants are dropped before they are queued for delivery. Core's own level
+ * for each category is lowered to the lowest threshold set by any port, so core only formats messages
+ * some port wants. The filters of a port are cleared when it detaches.
+ */
+RLM_API void realm_dart_set_log_filter(Dart_Port port, const char* category, realm_log_level_e level);
+
+/**
+ * Write log messages to a text file at path, from a background thread. Replaces any previously attached file sink.
+ *
+ * The file is memory mapped with a fixed size of max_file_size bytes. When it is full it is renamed to path.1,
+ * path.1 to path.2 and so on, keeping at most max_file_count files. An existing file at path is rotated the same way.
+ * The sink receives messages whether any isolate is attached or not, until realm_dart_detach_file_log_sink is called.
+ *
+ * Only messages of categories[i], and its subcategories, with at least levels[i] are written to the file, with more
+ * specific categories taking precedence. The levels are in place before the sink receives its first message.
+ *
+ * @return true if the file could be created, false otherwise, with the error available from realm_get_last_error.
+ */
+RLM_API bool realm_dart_attach_file_log_sink(const char* path, uint64_t max_file_size, uint32_t max_file_count,
+                                             const char** categories, const realm_log_level_e* levels, size_t levels_count);
+
+RLM_API void realm_dart_detach_file_log_sink();
+
+/**
+ * Get the number of log messages dropped since process start, because they were logged faster than
+ * they could be delivered to the attached isolates.
+ */
+RLM_API uint64_t realm_dart_logger_get_dropped_count();
+
 RLM_API void realm_dart_log(realm_log_level_e level, const char* category, const char* message);
 
 #endif // REALM_DART_LOGGER_H
\ No newline at end of file
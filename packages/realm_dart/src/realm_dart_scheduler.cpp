@@ -16,14 +16,33 @@
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
 #include <sstream>
 #include <set>
 #include <mutex>
 #include <thread>
+#include <vector>
+#include <realm/util/assert.hpp>
 
+#include "realm_dart.hpp"
 #include "realm_dart_scheduler.h"
 #include "realm_dart_logger.h"
-struct SchedulerData {
+
+using Clock = std::chrono::steady_clock;
+
+// A work queue waiting to be run, and when core handed it to the scheduler.
+struct PendingWork {
+    realm_work_queue_t* work_queue;
+    Clock::time_point notified_at;
+};
+
+struct SchedulerData : std::enable_shared_from_this<SchedulerData> {
     //used for debugging
     std::thread::id threadId;
     uint64_t isolateId;
@@ -33,22 +52,64 @@ struct SchedulerData {
     void* callback_userData = nullptr;
     realm_free_userdata_func_t free_userData_func = nullptr;
 
+    // Work queues waiting to be run on the isolate, one queue per lane. All notifications arriving while a
+    // wake-up message is in flight are appended here and drained by that single message, lane by lane.
+    std::mutex mutex;
+    std::array<std::vector<PendingWork>, RLM_DART_SCHEDULER_LANE_COUNT> pending_work;
+    bool wakeup_pending = false;
+
+    // zero means drain everything on each wake-up
+    std::atomic<int64_t> drain_budget_us{ 0 };
+
+    std::atomic<uint64_t> notify_count{ 0 };
+    std::atomic<uint64_t> post_count{ 0 };
+    std::atomic<uint64_t> coalesced_count{ 0 };
+    std::atomic<uint64_t> drained_count{ 0 };
+    std::atomic<uint64_t> deferred_count{ 0 };
+    std::atomic<uint64_t> invoke_count{ 0 };
+    LatencyHistogram latency;
+
+    void post_wakeup() {
+        post_count.fetch_add(1, std::memory_order_relaxed);
+        std::uintptr_t pointer = reinterpret_cast<std::uintptr_t>(this);
+        Dart_PostInteger_DL(port, pointer);
+    }
+
     SchedulerData(uint64_t isolate, Dart_Port dartPort)
         : port(dartPort), threadId(std::this_thread::get_id()), isolateId(isolate)
     {}
 };
 
+// The userdata of each realm_scheduler_t. All lanes of an isolate share the same SchedulerData,
+// which lives for as long as any of its lanes.
+struct SchedulerLane {
+    std::shared_ptr<SchedulerData> data;
+    realm_dart_scheduler_lane_e lane;
+};
+
 //This can be invoked on any thread
 void realm_dart_scheduler_free_userData(void* userData) {
-    SchedulerData* schedulerData = static_cast<SchedulerData*>(userData);
-    delete schedulerData;
+    SchedulerLane* schedulerLane = static_cast<SchedulerLane*>(userData);
+    delete schedulerLane;
 }
 
 //This can be invoked on any thread.
 void realm_dart_scheduler_notify(void* userData, realm_work_queue_t* work_queue) {
-    auto& schedulerData = *static_cast<SchedulerData*>(userData);
-    std::uintptr_t pointer = reinterpret_cast<std::uintptr_t>(work_queue);
-    Dart_PostInteger_DL(schedulerData.port, pointer);
+    auto& schedulerLane = *static_cast<SchedulerLane*>(userData);
+    auto& schedulerData = *schedulerLane.data;
+    schedulerData.notify_count.fetch_add(1, std::memory_order_relaxed);
+    const auto notified_at = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(schedulerData.mutex);
+        schedulerData.pending_work[schedulerLane.lane].push_back({ work_queue, notified_at });
+        if (schedulerData.wakeup_pending) {
+            schedulerData.coalesced_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        schedulerData.wakeup_pending = true;
+    }
+
+    schedulerData.post_wakeup();
 }
 
 // This method is called by Realm Core to check if the realm access is on the correct thread.
@@ -80,10 +141,10 @@ bool realm_dart_scheduler_can_deliver_notifications(void* userData) {
 //
 // Note: Dart Isolates use a thread pool so the actual OS thread executing the Dart Isolate can change during even loops for the same Isolate.
 // This fact does not negatively impact the Realm Dart Scheduler implementation
-RLM_API realm_scheduler_t* realm_dart_create_scheduler(uint64_t isolateId, Dart_Port port) {
-    SchedulerData* schedulerData = new SchedulerData(isolateId, port);
+realm_scheduler_t* realm_dart_scheduler_new_lane(std::shared_ptr<SchedulerData> schedulerData, realm_dart_scheduler_lane_e lane) {
+    SchedulerLane* schedulerLane = new SchedulerLane{ std::move(schedulerData), lane };
 
-    return realm_scheduler_new(schedulerData,
+    return realm_scheduler_new(schedulerLane,
         realm_dart_scheduler_free_userData,
         realm_dart_scheduler_notify,
         realm_dart_scheduler_is_on_thread,
@@ -91,6 +152,177 @@ RLM_API realm_scheduler_t* realm_dart_create_scheduler(uint64_t isolateId, Dart_
         realm_dart_scheduler_can_deliver_notifications);
 }
 
+RLM_API realm_scheduler_t* realm_dart_create_scheduler(uint64_t isolateId, Dart_Port port, void** out_scheduler_data) {
+    auto schedulerData = std::make_shared<SchedulerData>(isolateId, port);
+    *out_scheduler_data = schedulerData.get();
+    return realm_dart_scheduler_new_lane(std::move(schedulerData), RLM_DART_SCHEDULER_LANE_NOTIFICATIONS);
+}
+
+RLM_API realm_scheduler_t* realm_dart_scheduler_create_lane(void* userData, realm_dart_scheduler_lane_e lane) {
+    auto& schedulerData = *static_cast<SchedulerData*>(userData);
+    return realm_dart_scheduler_new_lane(schedulerData.shared_from_this(), lane);
+}
+
+//This method is called from Dart on the Realm instance Isolate thread when the wake-up message posted by
+//realm_dart_scheduler_notify arrives.
+RLM_API void realm_dart_scheduler_invoke(uint64_t isolateId, void* userData) {
+    auto& schedulerData = *static_cast<SchedulerData*>(userData);
+    REALM_ASSERT(schedulerData.isolateId == isolateId);
+    schedulerData.invoke_count.fetch_add(1, std::memory_order_relaxed);
+
+    std::array<std::vector<PendingWork>, RLM_DART_SCHEDULER_LANE_COUNT> work;
+    {
+        // Clear the flag while holding the lock, so any notification arriving after this point posts a new wake-up.
+        std::lock_guard<std::mutex> lock(schedulerData.mutex);
+        work.swap(schedulerData.pending_work);
+        schedulerData.wakeup_pending = false;
+    }
+
+    using namespace std::chrono;
+    const auto budget = microseconds(schedulerData.drain_budget_us.load(std::memory_order_relaxed));
+    const auto deadline = Clock::now() + budget;
+
+    // Lanes are drained in priority order, so notifications always run before sync and app callbacks.
+    size_t drained = 0;
+    size_t deferred = 0;
+    std::array<size_t, RLM_DART_SCHEDULER_LANE_COUNT> drained_per_lane{};
+    for (size_t lane = 0; lane < work.size() && deferred == 0; ++lane) {
+        for (auto& pending : work[lane]) {
+            const auto now = Clock::now();
+            // always make progress, even if a single work queue exceeds the budget
+            if (drained > 0 && budget.count() > 0 && now >= deadline) {
+                break;
+            }
+            schedulerData.latency.record(duration_cast<microseconds>(now - pending.notified_at).count());
+            realm_scheduler_perform_work(pending.work_queue);
+            ++drained;
+            ++drained_per_lane[lane];
+        }
+        deferred = work[lane].size() - drained_per_lane[lane];
+    }
+    schedulerData.drained_count.fetch_add(drained, std::memory_order_relaxed);
+
+    if (deferred == 0) {
+        return;
+    }
+
+    // Out of budget. Put the rest in front of anything queued meanwhile, and yield to the event loop.
+    bool post;
+    {
+        std::lock_guard<std::mutex> lock(schedulerData.mutex);
+        deferred = 0;
+        for (size_t lane = 0; lane < work.size(); ++lane) {
+            auto& pending = schedulerData.pending_work[lane];
+            auto rest = work[lane].begin() + drained_per_lane[lane];
+            deferred += work[lane].end() - rest;
+            pending.insert(pending.begin(), rest, work[lane].end());
+        }
+        post = !schedulerData.wakeup_pending;
+        schedulerData.wakeup_pending = true;
+    }
+    schedulerData.deferred_count.fetch_add(deferred, std::memory_order_relaxed);
+    if (post) {
+        schedulerData.post_wakeup();
+    }
+}
+
+//This method can be called on any thread
+RLM_API void realm_dart_scheduler_set_drain_budget(void* userData, int64_t budget_us) {
+    auto& schedulerData = *static_cast<SchedulerData*>(userData);
+    schedulerData.drain_budget_us.store(budget_us < 0 ? 0 : budget_us, std::memory_order_relaxed);
+}
+
+//This method can be called on any thread
+RLM_API size_t realm_dart_scheduler_get_lane_depth(void* userData, realm_dart_scheduler_lane_e lane) {
+    auto& schedulerData = *static_cast<SchedulerData*>(userData);
+    std::lock_guard<std::mutex> lock(schedulerData.mutex);
+    return schedulerData.pending_work[lane].size();
+}
+
+//This method can be called on any thread
+RLM_API void realm_dart_scheduler_get_stats(void* userData, realm_dart_scheduler_stats_t* out_stats) {
+    auto& schedulerData = *static_cast<SchedulerData*>(userData);
+    out_stats->notify_count = schedulerData.notify_count.load(std::memory_order_relaxed);
+    out_stats->post_count = schedulerData.post_count.load(std::memory_order_relaxed);
+    out_stats->coalesced_count = schedulerData.coalesced_count.load(std::memory_order_relaxed);
+    out_stats->drained_count = schedulerData.drained_count.load(std::memory_order_relaxed);
+    out_stats->deferred_count = schedulerData.deferred_count.load(std::memory_order_relaxed);
+    out_stats->invoke_count = schedulerData.invoke_count.load(std::memory_order_relaxed);
+    out_stats->latency_p50_us = schedulerData.latency.percentile(0.50);
+    out_stats->latency_p99_us = schedulerData.latency.percentile(0.99);
+    out_stats->latency_max_us = schedulerData.latency.max_us.load(std::memory_order_relaxed);
+}
+
+// A native thread running work queues for realms that are never accessed from Dart.
+// There is a single event loop per process. It is never destroyed, as core may still post work to it during shutdown.
+struct EventLoop {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<realm_work_queue_t*> work;
+    std::thread::id thread_id;
+
+    EventLoop() {
+        std::thread thread([this] { run(); });
+        thread_id = thread.get_id();
+        thread.detach();
+    }
+
+    void post(realm_work_queue_t* work_queue) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            work.push_back(work_queue);
+        }
+        cv.notify_one();
+    }
+
+    void run() {
+        std::deque<realm_work_queue_t*> ready;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return !work.empty(); });
+                ready.swap(work);
+            }
+            for (auto work_queue : ready) {
+                realm_scheduler_perform_work(work_queue);
+            }
+            ready.clear();
+        }
+    }
+
+    bool is_on_thread() const {
+        return std::this_thread::get_id() == thread_id;
+    }
+
+    static EventLoop& get() {
+        static EventLoop* event_loop = new EventLoop();
+        return *event_loop;
+    }
+};
+
+//The event loop outlives all schedulers using it
+void realm_dart_event_loop_free_userData(void* userData) {
+}
+
+//This can be invoked on any thread.
+void realm_dart_event_loop_notify(void* userData, realm_work_queue_t* work_queue) {
+    static_cast<EventLoop*>(userData)->post(work_queue);
+}
+
+//This method can be called on any thread
+bool realm_dart_event_loop_is_on_thread(void* userData) {
+    return static_cast<EventLoop*>(userData)->is_on_thread();
+}
+
+RLM_API realm_scheduler_t* realm_dart_create_event_loop_scheduler() {
+    return realm_scheduler_new(&EventLoop::get(),
+        realm_dart_event_loop_free_userData,
+        realm_dart_event_loop_notify,
+        realm_dart_event_loop_is_on_thread,
+        realm_dart_scheduler_is_same_as,
+        realm_dart_scheduler_can_deliver_notifications);
+}
+
 //Used for debugging
 RLM_API uint64_t realm_dart_get_thread_id() {
     std::stringstream ss;
@@ -22,10 +22,82 @@
 #include <realm.h>
 #include <dart_api_dl.h>
 
-RLM_API realm_scheduler_t* realm_dart_create_scheduler(uint64_t isolateId, Dart_Port port);
+// Lanes of work delivered on the isolate, in order of priority.
+typedef enum realm_dart_scheduler_lane {
+    // collection, object and realm change notifications
+    RLM_DART_SCHEDULER_LANE_NOTIFICATIONS = 0,
+    // sync and app callbacks, such as progress, connection state and completion handlers
+    RLM_DART_SCHEDULER_LANE_CALLBACKS = 1,
 
+    RLM_DART_SCHEDULER_LANE_COUNT = 2,
+} realm_dart_scheduler_lane_e;
+
+typedef struct realm_dart_scheduler_stats {
+    // number of times core asked the scheduler to run a work queue
+    uint64_t notify_count;
+    // number of wake-up messages actually posted to the Dart port, including re-posts of deferred work
+    uint64_t post_count;
+    // number of notifications that piggybacked on an already pending wake-up
+    uint64_t coalesced_count;
+    // number of work queues run on the isolate
+    uint64_t drained_count;
+    // number of times a work queue was pushed to a later wake-up because the drain budget ran out
+    uint64_t deferred_count;
+    // number of wake-ups handled on the isolate
+    uint64_t invoke_count;
+    // time from core notifying the scheduler until the work starts running on the isolate,
+    // measured with a monotonic clock. Percentiles are rounded up to the next power of two.
+    uint64_t latency_p50_us;
+    uint64_t latency_p99_us;
+    uint64_t latency_max_us;
+} realm_dart_scheduler_stats_t;
+
+/**
+ * Create a scheduler that delivers work on the isolate listening on port.
+ * The returned scheduler delivers on the notifications lane.
+ *
+ * @param[out] out_scheduler_data The scheduler state. It is posted to port as wake-up message
+ *                                and must be passed to realm_dart_scheduler_invoke.
+ *                                It is valid for as long as the returned scheduler is alive.
+ */
+RLM_API realm_scheduler_t* realm_dart_create_scheduler(uint64_t isolateId, Dart_Port port, void** out_scheduler_data);
+
+/**
+ * Create a scheduler sharing the wake-ups of the one created by realm_dart_create_scheduler,
+ * but delivering on the given lane.
+ */
+RLM_API realm_scheduler_t* realm_dart_scheduler_create_lane(void* userData, realm_dart_scheduler_lane_e lane);
+
+/**
+ * Run all work queued on the scheduler since the last wake-up, lane by lane.
+ *
+ * Must be called on the isolate owning the scheduler.
+ */
 RLM_API void realm_dart_scheduler_invoke(uint64_t isolateId, void* userData);
 
+/**
+ * Limit the time a single realm_dart_scheduler_invoke may spend running work.
+ *
+ * When the budget is spent the remaining work is re-posted to the isolate, so it runs on a later
+ * turn of the event loop. At least one work queue is run per invocation.
+ *
+ * @param budget_us The budget in microseconds. Zero, the default, means no limit.
+ */
+RLM_API void realm_dart_scheduler_set_drain_budget(void* userData, int64_t budget_us);
+
+/**
+ * Create a scheduler running work on a native event loop thread, shared by the whole process.
+ *
+ * Realms bound to this scheduler are confined to the event loop thread and must never be accessed
+ * from Dart. Use it for realms core opens internally, such as the one behind an async open task,
+ * so their work completes without waking the isolate.
+ */
+RLM_API realm_scheduler_t* realm_dart_create_event_loop_scheduler();
+
+RLM_API size_t realm_dart_scheduler_get_lane_depth(void* userData, realm_dart_scheduler_lane_e lane);
+
+RLM_API void realm_dart_scheduler_get_stats(void* userData, realm_dart_scheduler_stats_t* out_stats);
+
 RLM_API uint64_t realm_dart_get_thread_id();
 
 #endif // REALM_DART_SCHEDULER_H
\ No newline at end of file
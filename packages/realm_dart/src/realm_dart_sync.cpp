@@ -19,20 +19,150 @@
 #include <realm/object-store/sync/sync_session.hpp>
 #include <realm/sync/config.hpp>
 
+#include <realm/util/logger.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include "realm_dart.hpp"
 #include "realm_dart_sync.h"
 
+namespace {
+// A payload copied into a single heap block, together with the strings and arrays it points to.
+// The block is laid out in two passes: flat_size measures it, then flat_block copies into it in the same order.
+struct flat_block_deleter {
+    void operator()(void* block) const noexcept {
+        std::free(block);
+    }
+};
+
+template <typename T>
+using flat_ptr = std::unique_ptr<T, flat_block_deleter>;
+
+inline size_t align_up(size_t offset, size_t alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+inline size_t length_of(const char* str) {
+    return str ? std::strlen(str) : 0;
+}
+
+class flat_size {
+public:
+    template <typename T>
+    flat_size& add(size_t count = 1) {
+        m_size = align_up(m_size, alignof(T)) + sizeof(T) * count;
+        return *this;
+    }
+
+    flat_size& add_string(const char* str) {
+        return add<char>(length_of(str) + 1);
+    }
+
+    flat_size& add_value(const realm_value_t& value) {
+        if (value.type == RLM_TYPE_STRING) {
+            add<char>(value.string.size + 1);
+        }
+        else if (value.type == RLM_TYPE_BINARY) {
+            add<uint8_t>(value.binary.size);
+        }
+        return *this;
+    }
+
+    size_t size() const {
+        return m_size;
+    }
+
+private:
+    size_t m_size = 0;
+};
+
+class flat_block {
+public:
+    explicit flat_block(const flat_size& size)
+    : m_size(size.size())
+    , m_data(static_cast<char*>(std::malloc(m_size)))
+    {
+        if (!m_data) {
+            throw std::bad_alloc();
+        }
+    }
+
+    ~flat_block() {
+        std::free(m_data);
+    }
+
+    template <typename T>
+    T* alloc(size_t count = 1) {
+        m_offset = align_up(m_offset, alignof(T));
+        auto ptr = reinterpret_cast<T*>(m_data + m_offset);
+        m_offset += sizeof(T) * count;
+        REALM_ASSERT(m_offset <= m_size);
+        return ptr;
+    }
+
+    const char* copy_string(const char* str) {
+        const auto length = length_of(str);
+        auto copy = alloc<char>(length + 1);
+        if (length) {
+            std::memcpy(copy, str, length);
+        }
+        copy[length] = '\0';
+        return copy;
+    }
+
+    realm_value_t copy_value(realm_value_t value) {
+        if (value.type == RLM_TYPE_STRING) {
+            auto copy = alloc<char>(value.string.size + 1);
+            if (value.string.size) {
+                std::memcpy(copy, value.string.data, value.string.size);
+            }
+            copy[value.string.size] = '\0';
+            value.string.data = copy;
+        }
+        else if (value.type == RLM_TYPE_BINARY) {
+            auto copy = alloc<uint8_t>(value.binary.size);
+            if (value.binary.size) {
+                std::memcpy(copy, value.binary.data, value.binary.size);
+            }
+            value.binary.data = copy;
+        }
+        return value;
+    }
+
+    // the first allocation is the root of the payload
+    template <typename T>
+    flat_ptr<T> release() {
+        return flat_ptr<T>(reinterpret_cast<T*>(std::exchange(m_data, nullptr)));
+    }
+
+private:
+    const size_t m_size;
+    char* m_data;
+    size_t m_offset = 0;
+};
+}
+
 RLM_API void realm_dart_http_request_callback(realm_userdata_t userdata, realm_http_request_t request, void* request_context) {
     // the pointers in request are to stack values, we need to make copies and move them into the scheduler invocation
     struct request_copy_buf {
         std::string url;
-        std::string body;
         std::vector<std::pair<std::string, std::string>> headers_values;
         std::vector<realm_http_header_t> headers;
     } buf;
 
     buf.url = request.url;
-    buf.body = std::string(request.body, request.body_size);
     buf.headers_values.reserve(request.num_headers);
     buf.headers.reserve(request.num_headers);
     for (size_t i = 0; i < request.num_headers; i++) {
@@ -40,83 +170,82 @@ RLM_API void realm_dart_http_request_callback(realm_userdata_t userdata, realm_h
         buf.headers.push_back({ name.c_str(), value.c_str() });
     }
 
+    // the body is copied once, into a buffer the isolate takes over and reads in place
+    flat_ptr<char> body;
+    if (request.body_size > 0) {
+        body.reset(static_cast<char*>(std::malloc(request.body_size)));
+        if (!body) {
+            throw std::bad_alloc();
+        }
+        std::memcpy(body.get(), request.body, request.body_size);
+    }
+
     auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    ud->scheduler->invoke([ud, request = std::move(request), buf = std::move(buf), request_context]() mutable {
+    const auto queued_at = std::chrono::steady_clock::now();
+    ud->scheduler->invoke([ud, request = std::move(request), buf = std::move(buf), body = std::move(body), request_context, queued_at]() mutable {
         //we moved buf so we need to update the request pointers here.
         request.url = buf.url.c_str();
-        request.body = buf.body.data();
+        request.body = body.release();
         request.headers = buf.headers.data();
-        (reinterpret_cast<realm_http_request_func_t>(ud->dart_callback)(ud->handle, request, request_context));
+        const auto queued_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - queued_at).count();
+        (reinterpret_cast<realm_dart_http_request_func_t>(ud->dart_callback)(ud->handle, request, request_context, static_cast<uint64_t>(queued_us)));
     });
 }
 
-RLM_API void realm_dart_sync_error_handler_callback(realm_userdata_t userdata, realm_sync_session_t* session, realm_sync_error_t error)
-{
-    // the pointers in error are to stack values, we need to make copies and move them into the scheduler invocation
-    struct compensating_write_copy {
-        std::string reason;
-        std::string object_name;
-        realm_value_t primary_key;
-    };
+RLM_API void realm_dart_http_request_body_free(void* body) {
+    std::free(body);
+}
 
-    struct error_copy {
-        std::string message;
-        realm_errno_e error;
-        realm_error_categories categories;
-        std::string original_file_path_key;
-        std::string recovery_file_path_key;
-        bool is_fatal;
-        bool is_client_reset_requested;
-        std::vector<std::pair<std::string, std::string>> user_info_values;
-        std::vector<realm_sync_error_user_info_t> user_info;
-        std::vector<compensating_write_copy> compensating_writes_errors_info_copy;
-        std::vector<realm_sync_error_compensating_write_info_t> compensating_writes_errors_info;
-    } buf;
+// A compensating write storm can carry thousands of entries, so the whole error is copied into a single block
+static flat_ptr<realm_sync_error_t> realm_sync_error_copy(const realm_sync_error_t& error)
+{
+    flat_size size;
+    size.add<realm_sync_error_t>()
+        .add<realm_sync_error_user_info_t>(error.user_info_length)
+        .add<realm_sync_error_compensating_write_info_t>(error.compensating_writes_length)
+        .add_string(error.status.message)
+        .add_string(error.c_original_file_path_key)
+        .add_string(error.c_recovery_file_path_key);
+    for (size_t i = 0; i < error.user_info_length; i++) {
+        size.add_string(error.user_info_map[i].key).add_string(error.user_info_map[i].value);
+    }
+    for (size_t i = 0; i < error.compensating_writes_length; i++) {
+        const auto& cw = error.compensating_writes[i];
+        size.add_string(cw.reason).add_string(cw.object_name).add_value(cw.primary_key);
+    }
 
-    buf.message = std::string(error.status.message);
-    buf.categories = error.status.categories;
-    buf.error = error.status.error;
+    flat_block block(size);
+    auto copy = block.alloc<realm_sync_error_t>();
+    *copy = error;
+    auto user_info = block.alloc<realm_sync_error_user_info_t>(error.user_info_length);
+    auto compensating_writes = block.alloc<realm_sync_error_compensating_write_info_t>(error.compensating_writes_length);
     // TODO: Map usercode_error and path when issue https://github.com/realm/realm-core/issues/6925 is fixed
-    buf.original_file_path_key = std::string(error.c_original_file_path_key);
-    buf.recovery_file_path_key = std::string(error.c_recovery_file_path_key);
-    buf.is_fatal = error.is_fatal;
-    buf.is_client_reset_requested = error.is_client_reset_requested;
-    buf.user_info_values.reserve(error.user_info_length);
-    buf.user_info.reserve(error.user_info_length);
-    buf.compensating_writes_errors_info_copy.reserve(error.compensating_writes_length);
-    buf.compensating_writes_errors_info.reserve(error.compensating_writes_length);
-
+    copy->status.message = block.copy_string(error.status.message);
+    copy->c_original_file_path_key = block.copy_string(error.c_original_file_path_key);
+    copy->c_recovery_file_path_key = block.copy_string(error.c_recovery_file_path_key);
     for (size_t i = 0; i < error.user_info_length; i++) {
-        auto& [key, value] = buf.user_info_values.emplace_back(error.user_info_map[i].key, error.user_info_map[i].value);
-        buf.user_info.push_back({ key.c_str(), value.c_str() });
+        user_info[i].key = block.copy_string(error.user_info_map[i].key);
+        user_info[i].value = block.copy_string(error.user_info_map[i].value);
     }
     for (size_t i = 0; i < error.compensating_writes_length; i++) {
         const auto& cw = error.compensating_writes[i];
-        const auto& cw_buf = buf.compensating_writes_errors_info_copy.emplace_back(compensating_write_copy{
-            std::string(cw.reason),
-            std::string(cw.object_name),
-            cw.primary_key
-        });
-        buf.compensating_writes_errors_info.push_back(realm_sync_error_compensating_write_info_t{
-            cw_buf.reason.c_str(),
-            cw_buf.object_name.c_str(),
-            cw_buf.primary_key
-        });
+        compensating_writes[i].reason = block.copy_string(cw.reason);
+        compensating_writes[i].object_name = block.copy_string(cw.object_name);
+        compensating_writes[i].primary_key = block.copy_value(cw.primary_key);
     }
+    copy->user_info_map = user_info;
+    copy->compensating_writes = compensating_writes;
+    return block.release<realm_sync_error_t>();
+}
+
+RLM_API void realm_dart_sync_error_handler_callback(realm_userdata_t userdata, realm_sync_session_t* session, realm_sync_error_t error)
+{
+    // the pointers in error are to stack values, we need to make a copy and move it into the scheduler invocation
+    auto error_copy = realm_sync_error_copy(error);
 
     auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    ud->scheduler->invoke([ud, session = *session, error = std::move(error), buf = std::move(buf)]() mutable {
-        //we moved buf so we need to update the error pointers here.
-        error.status.message = buf.message.c_str();
-        error.status.error = buf.error;
-        error.status.categories = buf.categories;
-        error.c_original_file_path_key = buf.original_file_path_key.c_str();
-        error.c_recovery_file_path_key = buf.recovery_file_path_key.c_str();
-        error.is_fatal = buf.is_fatal;
-        error.is_client_reset_requested = buf.is_client_reset_requested;
-        error.user_info_map = buf.user_info.data();
-        error.compensating_writes = buf.compensating_writes_errors_info.data();
-        (reinterpret_cast<realm_sync_error_handler_func_t>(ud->dart_callback))(ud->handle, const_cast<realm_sync_session_t*>(&session), error);
+    ud->scheduler->invoke([ud, session = *session, error = std::move(error_copy)]() mutable {
+        (reinterpret_cast<realm_sync_error_handler_func_t>(ud->dart_callback))(ud->handle, const_cast<realm_sync_session_t*>(&session), *error);
     });
 }
 
@@ -147,14 +276,179 @@ RLM_API void realm_dart_sync_wait_for_completion_callback(realm_userdata_t userd
     });
 }
 
-RLM_API void realm_dart_sync_progress_callback(realm_userdata_t userdata, uint64_t transferred_bytes, uint64_t total_bytes, double estimate)
-{
-    auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    ud->scheduler->invoke([ud, transferred_bytes, total_bytes, estimate]() {
+namespace {
+// Runs functions once their time has come, on a single native thread per process.
+// Like the native event loop, it is never destroyed, as it may still be used during shutdown.
+class DelayedInvoker {
+public:
+    static DelayedInvoker& get() {
+        static DelayedInvoker* invoker = new DelayedInvoker();
+        return *invoker;
+    }
+
+    void invoke_at(std::chrono::steady_clock::time_point when, realm::util::UniqueFunction<void()>&& func) {
+        {
+            std::lock_guard lock(m_mutex);
+            m_queue.emplace(when, std::move(func));
+        }
+        m_condition.notify_one();
+    }
+
+private:
+    DelayedInvoker() {
+        std::thread([this] { run(); }).detach();
+    }
+
+    void run() {
+        std::unique_lock lock(m_mutex);
+        while (true) {
+            if (m_queue.empty()) {
+                m_condition.wait(lock);
+                continue;
+            }
+            const auto first = m_queue.begin();
+            if (std::chrono::steady_clock::now() < first->first) {
+                m_condition.wait_until(lock, first->first);
+                continue;
+            }
+            auto func = std::move(first->second);
+            m_queue.erase(first);
+            lock.unlock();
+            func();
+            lock.lock();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::multimap<std::chrono::steady_clock::time_point, realm::util::UniqueFunction<void()>> m_queue;
+};
+}
+
+struct realm_dart_sync_progress_userdata;
+
+// The latest progress tick of a subscription, shared with the trailing delivery scheduled for it,
+// which may run after the userdata is freed.
+struct ProgressTicks {
+    ProgressTicks(realm_dart_sync_progress_userdata* ud, std::shared_ptr<realm::util::Scheduler> scheduler, uint64_t interval_ms)
+    : ud(ud)
+    , scheduler(std::move(scheduler))
+    , interval(interval_ms)
+    { }
+
+    realm_dart_sync_progress_userdata* const ud;
+    const std::shared_ptr<realm::util::Scheduler> scheduler;
+    const std::chrono::milliseconds interval;
+
+    std::mutex mutex;
+    uint64_t transferred_bytes = 0;
+    uint64_t total_bytes = 0;
+    double estimate = 0;
+    bool undelivered = false;
+    bool delivery_pending = false;
+    bool trailing_delivery_scheduled = false;
+    bool freed = false;
+    std::chrono::steady_clock::time_point last_delivery;
+};
+
+// Progress ticks are coalesced per subscription. Only the latest tick is kept, and it is delivered
+// when no delivery is pending on the isolate and the interval has passed since the last one.
+// A tick arriving sooner is delivered once the interval has passed, unless a newer one replaces it first.
+// A completion tick is delivered regardless of the interval.
+struct realm_dart_sync_progress_userdata : realm_dart_userdata_async {
+    realm_dart_sync_progress_userdata(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t interval_ms)
+    : realm_dart_userdata_async(handle, callback, scheduler)
+    , ticks(std::make_shared<ProgressTicks>(this, this->scheduler, interval_ms))
+    { }
+
+    const std::shared_ptr<ProgressTicks> ticks;
+};
+
+namespace {
+// Called with the lock of ticks held. Deliveries are posted before the userdata is deleted, which is
+// posted once it is freed, so they always see it live.
+void post_progress_delivery(const std::shared_ptr<ProgressTicks>& ticks) {
+    ticks->delivery_pending = true;
+    ticks->scheduler->invoke([ticks]() {
+        uint64_t transferred_bytes, total_bytes;
+        double estimate;
+        {
+            std::lock_guard lock(ticks->mutex);
+            transferred_bytes = ticks->transferred_bytes;
+            total_bytes = ticks->total_bytes;
+            estimate = ticks->estimate;
+            ticks->undelivered = false;
+            ticks->delivery_pending = false;
+            ticks->last_delivery = std::chrono::steady_clock::now();
+        }
+        auto ud = ticks->ud;
         (reinterpret_cast<realm_sync_progress_func_t>(ud->dart_callback))(ud->handle, transferred_bytes, total_bytes, estimate);
     });
 }
 
+// Called with the lock of ticks held. Delivers the latest tick once the interval since the last delivery
+// has passed, in case no tick arrives after it to trigger a delivery.
+void schedule_trailing_progress_delivery(const std::shared_ptr<ProgressTicks>& ticks, std::chrono::steady_clock::time_point due) {
+    ticks->trailing_delivery_scheduled = true;
+    DelayedInvoker::get().invoke_at(due, [ticks]() {
+        std::lock_guard lock(ticks->mutex);
+        ticks->trailing_delivery_scheduled = false;
+        if (ticks->freed || !ticks->undelivered || ticks->delivery_pending) {
+            return;
+        }
+        // another delivery may have happened since this was scheduled
+        const auto due = ticks->last_delivery + ticks->interval;
+        if (std::chrono::steady_clock::now() < due) {
+            schedule_trailing_progress_delivery(ticks, due);
+            return;
+        }
+        post_progress_delivery(ticks);
+    });
+}
+}
+
+RLM_API realm_dart_userdata_async_t realm_dart_sync_progress_userdata_new(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t interval_ms)
+{
+    return new realm_dart_sync_progress_userdata(handle, callback, scheduler, interval_ms);
+}
+
+RLM_API void realm_dart_sync_progress_userdata_free(void* userdata)
+{
+    // posted after any pending delivery, so those still see a live userdata
+    auto ud = reinterpret_cast<realm_dart_sync_progress_userdata*>(userdata);
+    {
+        std::lock_guard lock(ud->ticks->mutex);
+        ud->ticks->freed = true;
+    }
+    ud->scheduler->invoke([ud]() {
+        delete ud;
+    });
+}
+
+RLM_API void realm_dart_sync_progress_callback(realm_userdata_t userdata, uint64_t transferred_bytes, uint64_t total_bytes, double estimate)
+{
+    auto ud = reinterpret_cast<realm_dart_sync_progress_userdata*>(userdata);
+    const auto& ticks = ud->ticks;
+    std::lock_guard lock(ticks->mutex);
+    ticks->transferred_bytes = transferred_bytes;
+    ticks->total_bytes = total_bytes;
+    ticks->estimate = estimate;
+    ticks->undelivered = true;
+    if (ticks->delivery_pending) {
+        return; // the pending delivery picks up this tick
+    }
+    const bool is_complete = estimate >= 1.0 || transferred_bytes >= total_bytes;
+    const auto due = ticks->last_delivery + ticks->interval;
+    if (!is_complete && std::chrono::steady_clock::now() < due) {
+        // folded into the next delivery
+        if (!ticks->trailing_delivery_scheduled) {
+            schedule_trailing_progress_delivery(ticks, due);
+        }
+        return;
+    }
+    post_progress_delivery(ticks);
+}
+
 RLM_API void realm_dart_sync_connection_state_changed_callback(realm_userdata_t userdata,
                                                                realm_sync_connection_state_e old_state,
                                                                realm_sync_connection_state_e new_state)
@@ -182,26 +476,199 @@ RLM_API void realm_dart_sync_on_subscription_state_changed_callback(realm_userda
     });
 }
 
-bool invoke_dart_and_await_result(realm::util::UniqueFunction<void(realm::util::UniqueFunction<void(realm_userdata_t)>*)>* userCallback)
-{
-    std::condition_variable condition;
+namespace {
+// Counters shared by all client reset handshakes in the process
+struct ClientResetMetrics {
+    std::atomic<uint64_t> count{ 0 };
+    std::atomic<uint64_t> timeout_count{ 0 };
+    std::atomic<uint64_t> cancelled_count{ 0 };
+    std::atomic<uint64_t> total_wait_us{ 0 };
+    std::atomic<uint64_t> max_wait_us{ 0 };
+    std::atomic<uint32_t> in_flight{ 0 };
+} client_reset_metrics;
+
+// The state shared between the sync thread waiting for a client reset callback and the isolate running it.
+// The isolate may still pick up the callback after the sync thread gave up on it, so it is reference counted.
+struct ClientResetHandshake {
     std::mutex mutex;
+    std::condition_variable condition;
     realm_userdata_t user_error = nullptr;
+    // the realm core passes to the handler only lives until the handler returns, which may be before the
+    // callback completes, so the callback gets a copy that lives as long as the handshake
+    std::unique_ptr<realm_t, decltype(&realm_release)> before_realm{ nullptr, realm_release };
+    bool started = false;
+    bool entered = false; // the callback is running its synchronous part, which reads the arguments from core
     bool completed = false;
+    bool abandoned = false;
+};
 
-    realm::util::UniqueFunction unlockFunc = [&](realm_userdata_t error) {
-        std::unique_lock lock(mutex);
-        user_error = error;
-        completed = true;
-        condition.notify_one();
-    };
+// The waits of the sync threads on the client reset callbacks of one handler. Each waiter holds a reference,
+// so a handler freed while a sync thread is waiting on it doesn't take the state from under that thread.
+struct ClientResetWaiters {
+    explicit ClientResetWaiters(uint64_t timeout_ms)
+    : timeout(timeout_ms)
+    { }
+
+    void cancel() {
+        std::lock_guard lock(mutex);
+        cancelled = true;
+        for (auto& handshake : pending) {
+            std::lock_guard handshake_lock(handshake->mutex);
+            handshake->condition.notify_all();
+        }
+    }
+
+    const std::chrono::milliseconds timeout; // zero waits indefinitely
+
+    std::mutex mutex;
+    std::atomic<bool> cancelled{ false };
+    std::vector<std::shared_ptr<ClientResetHandshake>> pending;
+};
+}
+
+// The userdata of the client reset handlers. Cancelling it releases the sync threads waiting on it,
+// which happens when core drops the handler, so a session being torn down never waits for an isolate.
+struct realm_dart_client_reset_userdata : realm_dart_userdata_async {
+    realm_dart_client_reset_userdata(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t timeout_ms)
+    : realm_dart_userdata_async(handle, callback, scheduler)
+    , waiters(std::make_shared<ClientResetWaiters>(timeout_ms))
+    { }
+
+    const std::shared_ptr<ClientResetWaiters> waiters;
+};
+
+RLM_API realm_dart_userdata_async_t realm_dart_client_reset_userdata_new(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t timeout_ms)
+{
+    return new realm_dart_client_reset_userdata(handle, callback, scheduler, timeout_ms);
+}
+
+RLM_API void realm_dart_client_reset_userdata_free(void* userdata)
+{
+    auto ud = reinterpret_cast<realm_dart_client_reset_userdata*>(userdata);
+    ud->waiters->cancel();
+    ud->scheduler->invoke([ud]() {
+        delete ud;
+    });
+}
+
+RLM_API void realm_dart_client_reset_get_metrics(realm_dart_client_reset_metrics_t* out_metrics)
+{
+    out_metrics->count = client_reset_metrics.count.load();
+    out_metrics->timeout_count = client_reset_metrics.timeout_count.load();
+    out_metrics->cancelled_count = client_reset_metrics.cancelled_count.load();
+    out_metrics->total_wait_us = client_reset_metrics.total_wait_us.load();
+    out_metrics->max_wait_us = client_reset_metrics.max_wait_us.load();
+    out_metrics->in_flight = client_reset_metrics.in_flight.load();
+}
+
+using unlock_func_t = realm::util::UniqueFunction<void(realm_userdata_t)>;
+
+// Core expects the result of a client reset handler synchronously, so the sync thread has to wait for the isolate.
+// The timeout bounds the whole wait, for the isolate to start the callback and for the callback to complete, and
+// cancellation ends it right away. Either way the reset fails, and a callback still running is left to finish
+// on the isolate with its result ignored.
+bool invoke_dart_and_await_result(realm_dart_client_reset_userdata* ud, const char* handler_name, realm_t* before_realm,
+                                  realm::util::UniqueFunction<void(realm_t*, unlock_func_t*)>&& dart_callback)
+{
+    // ud may be freed once the handler is cancelled, so only the waiters are used after waking up
+    const auto waiters = ud->waiters;
+    const auto scheduler = ud->scheduler;
+    auto handshake = std::make_shared<ClientResetHandshake>();
+    handshake->before_realm.reset(static_cast<realm_t*>(realm_clone(before_realm)));
+    {
+        std::lock_guard lock(waiters->mutex);
+        if (waiters->cancelled) {
+            client_reset_metrics.cancelled_count++;
+            return false;
+        }
+        waiters->pending.push_back(handshake);
+    }
+
+    // owned and freed by realm_dart_invoke_unlock_callback, which the isolate calls exactly once per started callback
+    auto unlockFunc = new unlock_func_t([handshake](realm_userdata_t error) {
+        std::lock_guard lock(handshake->mutex);
+        if (handshake->abandoned) {
+            // nobody is left to report the error to
+            if (error) {
+                realm_dart_delete_persistent_handle(error);
+            }
+            return;
+        }
+        handshake->user_error = error;
+        handshake->completed = true;
+        handshake->condition.notify_all();
+    });
+
+    client_reset_metrics.count++;
+    client_reset_metrics.in_flight++;
+    const auto started = std::chrono::steady_clock::now();
+
+    // the isolate frees a cancelled handler after this runs, so a callback that isn't cancelled yet still sees it live
+    scheduler->invoke([handshake, waiters, unlockFunc, dart_callback = std::move(dart_callback)]() mutable {
+        {
+            std::lock_guard lock(handshake->mutex);
+            if (handshake->abandoned || waiters->cancelled) {
+                delete unlockFunc;
+                return;
+            }
+            handshake->started = true;
+            handshake->entered = true;
+        }
+        dart_callback(handshake->before_realm.get(), unlockFunc);
+        std::lock_guard lock(handshake->mutex);
+        handshake->entered = false;
+        handshake->condition.notify_all();
+    });
+
+    bool completed;
+    bool was_started;
+    {
+        std::unique_lock lock(handshake->mutex);
+        auto completed_or_cancelled = [&]() {
+            return handshake->completed || waiters->cancelled;
+        };
+        if (waiters->timeout.count() > 0) {
+            handshake->condition.wait_for(lock, waiters->timeout, completed_or_cancelled);
+        }
+        else {
+            handshake->condition.wait(lock, completed_or_cancelled);
+        }
+        // a timeout or cancellation can't abandon the callback while its synchronous part is still reading the arguments
+        handshake->condition.wait(lock, [&]() { return !handshake->entered; });
+        completed = handshake->completed;
+        was_started = handshake->started;
+        handshake->abandoned = !completed;
+    }
+
+    const auto waited_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - started).count());
+    client_reset_metrics.in_flight--;
+    client_reset_metrics.total_wait_us += waited_us;
+    auto max_wait_us = client_reset_metrics.max_wait_us.load();
+    while (waited_us > max_wait_us && !client_reset_metrics.max_wait_us.compare_exchange_weak(max_wait_us, waited_us)) {
+    }
+
+    {
+        std::lock_guard lock(waiters->mutex);
+        auto& pending = waiters->pending;
+        pending.erase(std::remove(pending.begin(), pending.end(), handshake), pending.end());
+    }
 
-    std::unique_lock lock(mutex);
-    (*userCallback)(&unlockFunc);
-    condition.wait(lock, [&]() { return completed; });
+    if (!completed) {
+        if (waiters->cancelled) {
+            client_reset_metrics.cancelled_count++;
+            realm::util::Logger::get_default_logger()->warn("The client reset %1 callback was cancelled before it %2", handler_name,
+                                                            was_started ? "completed" : "started");
+        }
+        else {
+            client_reset_metrics.timeout_count++;
+            realm::util::Logger::get_default_logger()->warn("The client reset %1 callback did not %2 within %3 ms", handler_name,
+                                                            was_started ? "complete" : "start", waiters->timeout.count());
+        }
+        return false;
+    }
 
-    if (user_error != nullptr) {
-        realm_register_user_code_callback_error(user_error);
+    if (handshake->user_error != nullptr) {
+        realm_register_user_code_callback_error(handshake->user_error);
         return false;
     }
 
@@ -210,24 +677,18 @@ bool invoke_dart_and_await_result(realm::util::UniqueFunction<void(realm::util::
 
 RLM_API bool realm_dart_sync_before_reset_handler_callback(realm_userdata_t userdata, realm_t* realm)
 {
-    auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    realm::util::UniqueFunction userCallback = [ud, realm](realm::util::UniqueFunction<void(realm_userdata_t)>* unlockFunc) {
-        ud->scheduler->invoke([ud, realm, unlockFunc]() {
-            (reinterpret_cast<realm_sync_before_client_reset_begin_func_t>(ud->dart_callback))(ud->handle, realm, unlockFunc);
-        });
-    };
-    return invoke_dart_and_await_result(&userCallback);
+    auto ud = reinterpret_cast<realm_dart_client_reset_userdata*>(userdata);
+    return invoke_dart_and_await_result(ud, "before reset", realm, [ud](realm_t* realm, unlock_func_t* unlockFunc) {
+        (reinterpret_cast<realm_sync_before_client_reset_begin_func_t>(ud->dart_callback))(ud->handle, realm, unlockFunc);
+    });
 }
 
 RLM_API bool realm_dart_sync_after_reset_handler_callback(realm_userdata_t userdata, realm_t* before_realm, realm_thread_safe_reference_t* after_realm, bool did_recover)
 {
-    auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    realm::util::UniqueFunction userCallback = [ud, before_realm, after_realm, did_recover](realm::util::UniqueFunction<void(realm_userdata_t)>* unlockFunc) {
-        ud->scheduler->invoke([ud, before_realm, after_realm, did_recover, unlockFunc]() {
-            (reinterpret_cast<realm_sync_after_client_reset_begin_func_t>(ud->dart_callback))(ud->handle, before_realm, after_realm, did_recover, unlockFunc);
-        });
-    };
-    return invoke_dart_and_await_result(&userCallback);
+    auto ud = reinterpret_cast<realm_dart_client_reset_userdata*>(userdata);
+    return invoke_dart_and_await_result(ud, "after reset", before_realm, [ud, after_realm, did_recover](realm_t* before_realm, unlock_func_t* unlockFunc) {
+        (reinterpret_cast<realm_sync_after_client_reset_begin_func_t>(ud->dart_callback))(ud->handle, before_realm, after_realm, did_recover, unlockFunc);
+    });
 }
 
 RLM_API void realm_dart_async_open_task_callback(realm_userdata_t userdata, realm_thread_safe_reference_t* realm, const realm_async_error_t* error)
@@ -240,33 +701,19 @@ RLM_API void realm_dart_async_open_task_callback(realm_userdata_t userdata, real
     });
 }
 
-std::unique_ptr<realm_app_error> realm_app_error_copy(const realm_app_error_t* error)
+flat_ptr<realm_app_error> realm_app_error_copy(const realm_app_error_t* error)
 {
     // we make a deep copy of error, so it is valid after callback returns
-    struct error_buf : realm_app_error
-    {
-        error_buf(const realm_app_error& error_input)
-            : message_buffer(error_input.message),
-            link_to_server_logs_buffer(error_input.link_to_server_logs ? error_input.link_to_server_logs : "")
-        {
-            error = error_input.error;
-            categories = error_input.categories;
-            http_status_code = error_input.http_status_code;
-            message = message_buffer.c_str();
-            link_to_server_logs = link_to_server_logs_buffer.c_str();
-        }
-
-        const std::string message_buffer;
-        const std::string link_to_server_logs_buffer;
-    };
-
-    std::unique_ptr<realm_app_error> error_copy;
-    if (error != nullptr) {
-        error_copy = std::make_unique<error_buf>(*error);
+    if (error == nullptr) {
+        return nullptr;
     }
 
-
-    return error_copy;
+    flat_block block(flat_size().add<realm_app_error>().add_string(error->message).add_string(error->link_to_server_logs));
+    auto copy = block.alloc<realm_app_error>();
+    *copy = *error;
+    copy->message = block.copy_string(error->message);
+    copy->link_to_server_logs = block.copy_string(error->link_to_server_logs);
+    return block.release<realm_app_error>();
 }
 
 RLM_API void realm_dart_user_completion_callback(realm_userdata_t userdata, realm_user_t* user, const realm_app_error_t* error)
@@ -297,35 +744,33 @@ RLM_API void realm_dart_void_completion_callback(realm_userdata_t userdata, cons
     });
 }
 
-struct apikey_buf : realm_app_user_apikey
+// the keys and their strings are copied into a single block
+flat_ptr<realm_app_user_apikey_t> realm_apikey_list_copy(const realm_app_user_apikey_t apikey_list[], size_t count)
 {
-    apikey_buf(const realm_app_user_apikey& apikey_input)
-        : key_buffer(apikey_input.key ? apikey_input.key : ""),
-        name_buffer(apikey_input.name ? apikey_input.name : "")
-    {
-        id = apikey_input.id;
-        key = key_buffer.c_str();
-        name = name_buffer.c_str();
-        disabled = apikey_input.disabled;
+    if (apikey_list == nullptr) {
+        return nullptr;
     }
 
-    const std::string key_buffer;
-    const std::string name_buffer;
-};
+    flat_size size;
+    size.add<realm_app_user_apikey_t>(count);
+    for (size_t i = 0; i < count; i++) {
+        size.add_string(apikey_list[i].key).add_string(apikey_list[i].name);
+    }
 
-std::unique_ptr<apikey_buf> realm_apikey_copy(const realm_app_user_apikey_t* apikey)
-{
-    std::unique_ptr<apikey_buf> apikey_copy;
-    if (apikey != nullptr) {
-        apikey_copy = std::make_unique<apikey_buf>(*apikey);
+    flat_block block(size);
+    auto copy = block.alloc<realm_app_user_apikey_t>(count);
+    for (size_t i = 0; i < count; i++) {
+        copy[i] = apikey_list[i];
+        copy[i].key = block.copy_string(apikey_list[i].key);
+        copy[i].name = block.copy_string(apikey_list[i].name);
     }
-    return apikey_copy;
+    return block.release<realm_app_user_apikey_t>();
 }
 
 RLM_API void realm_dart_apikey_callback(realm_userdata_t userdata, realm_app_user_apikey_t* apikey, const realm_app_error_t* error) {
     // we need to make a deep copies as the pointers point to stack memory
     auto error_copy = realm_app_error_copy(error);
-    auto apikey_copy = realm_apikey_copy(apikey);
+    auto apikey_copy = realm_apikey_list_copy(apikey, 1);
 
     auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
     ud->scheduler->invoke([ud, apikey = std::move(apikey_copy), error = std::move(error_copy)]() mutable {
@@ -333,47 +778,16 @@ RLM_API void realm_dart_apikey_callback(realm_userdata_t userdata, realm_app_use
     });
 }
 
-std::vector<apikey_buf> realm_apikey_list_copy(const realm_app_user_apikey_t apikey_list[], size_t count)
-{
-    // we make a deep copy of error, so it is valid after callback returns
-    std::vector<apikey_buf> apikey_list_copy;
-    if (apikey_list != nullptr) {
-        apikey_list_copy.reserve(count);
-        std::transform(
-            apikey_list,
-            apikey_list + count,
-            std::back_inserter(apikey_list_copy),
-            [](const realm_app_user_apikey_t& apikey) {
-            return apikey_buf(apikey);
-        }
-        );
-    }
-    return apikey_list_copy;
-}
-
-
 RLM_API void realm_dart_apikey_list_callback(realm_userdata_t userdata, realm_app_user_apikey_t apikey_list[], size_t count, const realm_app_error_t* error) {
     auto error_copy = realm_app_error_copy(error);
     auto apikey_list_copy = realm_apikey_list_copy(apikey_list, count);
+    if (!apikey_list_copy) {
+        count = 0;
+    }
 
     auto ud = reinterpret_cast<realm_dart_userdata_async_t>(userdata);
-    ud->scheduler->invoke([ud, apikey_list_buf = std::move(apikey_list_copy), error = std::move(error_copy)]() mutable {
-        std::vector<realm_app_user_apikey> apikey_list;
-        apikey_list.reserve(apikey_list_buf.size());
-        std::transform(
-            apikey_list_buf.begin(),
-            apikey_list_buf.end(),
-            std::back_inserter(apikey_list),
-            [](const apikey_buf& apikey) {
-            return realm_app_user_apikey{
-                apikey.id,
-                apikey.key_buffer.c_str(),
-                apikey.name_buffer.c_str(),
-                apikey.disabled
-            };
-        }
-        );
-        (reinterpret_cast<realm_return_apikey_list_func_t>(ud->dart_callback))(ud->handle, apikey_list.data(), apikey_list.size(), error.get());
+    ud->scheduler->invoke([ud, apikey_list = std::move(apikey_list_copy), count, error = std::move(error_copy)]() mutable {
+        (reinterpret_cast<realm_return_apikey_list_func_t>(ud->dart_callback))(ud->handle, apikey_list.get(), count, error.get());
     });
 }
 
@@ -19,16 +19,36 @@
 #pragma once
 
 #include <realm.h>
+#include "realm_dart.h"
 typedef void (*realm_sync_before_client_reset_begin_func_t)(realm_userdata_t userdata, realm_t* before_realm, void* unlockFunc);
 
 typedef void (*realm_sync_after_client_reset_begin_func_t)(realm_userdata_t userdata, realm_t* before_realm, realm_thread_safe_reference_t* after_realm, bool did_recover, void* unlockFunc);
 
+// The Dart request callback is also passed the time the request waited for the isolate
+typedef void (*realm_dart_http_request_func_t)(realm_userdata_t userdata, realm_http_request_t request, void* request_context, uint64_t queued_us);
+
 RLM_API void realm_dart_http_request_callback(realm_userdata_t userdata, realm_http_request_t request, void* request_context);
 
+/**
+ * Free the body of a request passed to the Dart request callback. The body is handed over to the isolate,
+ * which frees it once the list over it is garbage collected.
+ */
+RLM_API void realm_dart_http_request_body_free(void* body);
+
 RLM_API void realm_dart_sync_error_handler_callback(realm_userdata_t userdata, realm_sync_session_t* session, realm_sync_error_t error);
 
 RLM_API void realm_dart_sync_wait_for_completion_callback(realm_userdata_t userdata, realm_error_t* error);
 
+/**
+ * Create the userdata for realm_dart_sync_progress_callback. Ticks are coalesced, so at most one is waiting
+ * on the isolate and deliveries are at least interval_ms apart, except for the tick completing the transfer.
+ * The latest tick is always delivered, once interval_ms has passed since the previous delivery.
+ * Free with realm_dart_sync_progress_userdata_free.
+ */
+RLM_API realm_dart_userdata_async_t realm_dart_sync_progress_userdata_new(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t interval_ms);
+
+RLM_API void realm_dart_sync_progress_userdata_free(void* userdata);
+
 RLM_API void realm_dart_sync_progress_callback(realm_userdata_t userdata, uint64_t transferred_bytes, uint64_t total_bytes, double estimate);
 
 RLM_API void realm_dart_sync_connection_state_changed_callback(realm_userdata_t userdata,
@@ -39,6 +59,34 @@ RLM_API void realm_dart_user_change_callback(realm_userdata_t userdata, realm_us
 
 RLM_API void realm_dart_sync_on_subscription_state_changed_callback(realm_userdata_t userdata, realm_flx_sync_subscription_set_state_e state);
 
+typedef struct realm_dart_client_reset_metrics {
+    // the number of client reset callbacks invoked
+    uint64_t count;
+    // the number of callbacks that did not complete within the timeout
+    uint64_t timeout_count;
+    // the number of callbacks abandoned before they completed, because the handler was released first
+    uint64_t cancelled_count;
+    // the time sync threads spent waiting for callbacks, in total and the longest single wait
+    uint64_t total_wait_us;
+    uint64_t max_wait_us;
+    // the number of sync threads currently waiting for a callback
+    uint32_t in_flight;
+} realm_dart_client_reset_metrics_t;
+
+/**
+ * Create the userdata for the client reset handler callbacks. A sync thread blocks at most timeout_ms for the
+ * isolate to run a callback to completion, or indefinitely if it is zero. Free with realm_dart_client_reset_userdata_free,
+ * which also releases any sync thread still waiting for a callback.
+ */
+RLM_API realm_dart_userdata_async_t realm_dart_client_reset_userdata_new(Dart_Handle handle, void* callback, realm_scheduler_t* scheduler, uint64_t timeout_ms);
+
+RLM_API void realm_dart_client_reset_userdata_free(void* userdata);
+
+/**
+ * Get the process wide counters of the client reset callbacks.
+ */
+RLM_API void realm_dart_client_reset_get_metrics(realm_dart_client_reset_metrics_t* out_metrics);
+
 RLM_API bool realm_dart_sync_before_reset_handler_callback(realm_userdata_t userdata, realm_t* realm);
 
 RLM_API bool realm_dart_sync_after_reset_handler_callback(realm_userdata_t userdata, realm_t* before_realm, realm_thread_safe_reference_t* after_realm, bool did_recover);
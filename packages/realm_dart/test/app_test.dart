@@ -88,6 +88,53 @@ void main() {
     expect(app.id, configuration.appId);
   });
 
+  test('App with native HTTP transport reuses a connection to a local server', () async {
+    final paths = <String>[];
+    final clientPorts = <int>{};
+    final server = await platformUtil.startLocalHttpServer(404, {'error': 'stand-in server', 'error_code': 'AppNotFound'}, (path, clientPort) {
+      paths.add(path);
+      clientPorts.add(clientPort);
+    });
+
+    try {
+      final configuration = AppConfiguration(generateRandomString(10), baseUrl: server.uri, useNativeHttpTransport: true);
+      expect(configuration.useNativeHttpTransport, isTrue);
+
+      final app = App(configuration);
+      await expectLater(app.logIn(Credentials.anonymous()), throwsA(isA<AppException>()));
+      await expectLater(app.logIn(Credentials.anonymous()), throwsA(isA<AppException>()));
+
+      expect(paths, hasLength(greaterThanOrEqualTo(2)));
+      expect(paths.first, endsWith('/location'));
+      expect(clientPorts, hasLength(1));
+    } finally {
+      await server.close();
+    }
+  });
+
+  for (final useNativeHttpTransport in [false, true]) {
+    test('App.httpTransportMetrics records requests to a local server (native transport: $useNativeHttpTransport)', () async {
+      final server = await platformUtil.startLocalHttpServer(404, {'error': 'stand-in server', 'error_code': 'AppNotFound'}, (path, clientPort) {});
+
+      try {
+        final configuration = AppConfiguration(generateRandomString(10), baseUrl: server.uri, useNativeHttpTransport: useNativeHttpTransport);
+        final app = App(configuration);
+        await expectLater(app.logIn(Credentials.anonymous()), throwsA(isA<AppException>()));
+
+        final location = app.httpTransportMetrics.singleWhere((e) => e.path.endsWith('/location'));
+        expect(location.method, HttpMethod.get);
+        expect(location.requestCount, greaterThanOrEqualTo(1));
+        expect(location.inFlight, 0);
+        expect(location.timeoutCount + location.socketErrorCount + location.errorCount, 0);
+        expect(location.bytesReceived, greaterThan(0));
+        expect(location.latencyMax, greaterThanOrEqualTo(location.firstByteMax));
+        expect(location.firstByteMax, greaterThanOrEqualTo(location.queueMax));
+      } finally {
+        await server.close();
+      }
+    });
+  }
+
   test('AppConfiguration.baseUrl points to the correct value', () {
     final configuration = AppConfiguration('abc');
     expect(configuration.baseUrl, Uri.parse('https://services.cloud.mongodb.com'));
@@ -229,6 +276,16 @@ void main() {
     expect(map['arg'], arg1);
   });
 
+  baasTest('Call Atlas function with a large non-ASCII argument', (configuration) async {
+    final app = App(configuration);
+    final user = await app.logIn(Credentials.anonymous());
+    final arg1 = 'Jhonatan Æøå 🚀 ' * 20000;
+    final dynamic response = await user.functions.call('userFuncOneArg', [arg1]);
+    expect(response, isNotNull);
+    final map = response as Map<String, dynamic>;
+    expect(map['arg'], arg1);
+  });
+
   baasTest('Call Atlas function with two arguments', (configuration) async {
     final app = App(configuration);
     final user = await app.logIn(Credentials.anonymous());
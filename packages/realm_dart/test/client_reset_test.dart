@@ -402,6 +402,36 @@ void main() {
     expect(onBeforeResetOccurred, 1);
   });
 
+  baasTest('ClientResetHandler.metrics counts invoked callbacks', (appConfig) async {
+    final user = await getIntegrationUser(appConfig: appConfig);
+    final onAfterCompleter = Completer<void>();
+    final before = ClientResetHandler.metrics;
+
+    final config = Configuration.flexibleSync(
+      user,
+      getSyncSchema(),
+      clientResetHandler: DiscardUnsyncedChangesHandler(
+        callbackTimeout: Duration(minutes: 1),
+        onBeforeReset: (beforeResetRealm) async {
+          await Future<void>.delayed(Duration(milliseconds: 100));
+        },
+        onAfterReset: (beforeResetRealm, afterResetRealm) => onAfterCompleter.complete(),
+      ),
+    );
+
+    final realm = await getRealmAsync(config);
+    await realm.syncSession.waitForUpload();
+    await baasHelper!.triggerClientReset(realm);
+
+    await onAfterCompleter.future.wait(defaultWaitTimeout, "onAfterReset is not reported.");
+
+    final after = ClientResetHandler.metrics;
+    expect(after.count - before.count, greaterThanOrEqualTo(2));
+    expect(after.timeoutCount, before.timeoutCount);
+    expect(after.totalWait, greaterThan(before.totalWait));
+    expect(after.maxWait, greaterThanOrEqualTo(Duration(milliseconds: 100)));
+  });
+
   baasTest('onManualResetFallback is reported after async onAfterReset throws', (appConfig) async {
     final user = await getIntegrationUser(appConfig: appConfig);
     int onBeforeResetOccurred = 0;
@@ -1,10 +1,16 @@
 // Copyright 2023 MongoDB, Inc.
 // SPDX-License-Identifier: Apache-2.0
 
+import 'dart:ffi';
 import 'dart:math';
 
 import 'package:meta/meta.dart';
 import 'package:realm_dart/src/handles/decimal128.dart';
+import 'package:realm_dart/src/handles/native/decimal128.dart' as native;
+import 'package:realm_dart/src/handles/native/ffi.dart';
+import 'package:realm_dart/src/handles/native/from_native.dart';
+import 'package:realm_dart/src/handles/native/realm_bindings.dart';
+import 'package:realm_dart/src/handles/native/realm_library.dart';
 
 import 'test.dart';
 
@@ -35,6 +41,16 @@ void repeatTest(String description, dynamic Function(Decimal128 x, int xInt, Dec
   });
 }
 
+(int, int) bits(Decimal128 x) => (x as native.Decimal128).bits;
+
+Decimal128 fromNative(realm_decimal128_t x) => native.Decimal128Internal.fromNative(x);
+
+realm_decimal128_t toNative(Decimal128 x, Allocator allocator) {
+  final result = allocator<realm_decimal128_t>().ref;
+  (x as native.Decimal128).copyTo(result);
+  return result;
+}
+
 void main() {
   setupTests();
 
@@ -298,4 +314,136 @@ void main() {
     expect(x.abs(), (-x).abs());
     expect(x.abs(), x.abs().abs()); // abs is idempotent
   });
+
+  test('Decimal128.formatAll', () {
+    final random = Random(42);
+    final values = [
+      Decimal128.zero,
+      -Decimal128.zero,
+      Decimal128.nan,
+      Decimal128.infinity,
+      Decimal128.negativeInfinity,
+      Decimal128.parse('-9999999999999999999999999999999999E-6176'),
+      Decimal128.parse('9999999999999999999999999999999999E+6111'),
+      for (var i = 0; i < 1000; i++) Decimal128.fromInt(random.nextInt(1 << 32)) / Decimal128.fromInt(random.nextInt(1 << 16) + 1),
+    ];
+    expect(Decimal128.formatAll(values), values.map((v) => v.toString()).toList());
+    expect(Decimal128.formatAll([]), isEmpty);
+  });
+
+  test('Decimal128List', () {
+    final random = Random(42);
+    final xs = [for (var i = 0; i < 100; i++) Decimal128.fromInt(random.nextInt(1 << 32) - (1 << 31))];
+    final ys = [for (var i = 0; i < 100; i++) Decimal128.fromInt(random.nextInt(1 << 16) + 1)];
+    final x = Decimal128List.fromList(xs);
+    final y = Decimal128List.fromList(ys);
+
+    expect(x, xs);
+    expect(Decimal128List(3), [Decimal128.zero, Decimal128.zero, Decimal128.zero]);
+    expect(() => x.add(Decimal128.one), throwsUnsupportedError);
+
+    expect(x.combine(y, Decimal128Operation.add), [for (var i = 0; i < 100; i++) xs[i] + ys[i]]);
+    expect(x.combine(y, Decimal128Operation.subtract), [for (var i = 0; i < 100; i++) xs[i] - ys[i]]);
+    expect(x.combine(y, Decimal128Operation.multiply), [for (var i = 0; i < 100; i++) xs[i] * ys[i]]);
+    expect(x.combine(y, Decimal128Operation.divide), [for (var i = 0; i < 100; i++) xs[i] / ys[i]]);
+    expect(() => x.combine(Decimal128List(1), Decimal128Operation.add), throwsArgumentError);
+
+    final sum = xs.fold(Decimal128.zero, (a, b) => a + b);
+    expect(x.sum(), sum);
+    expect(x.min(), xs.reduce((a, b) => b < a ? b : a));
+    expect(x.max(), xs.reduce((a, b) => b > a ? b : a));
+    expect(x.average(), sum / Decimal128.fromInt(xs.length));
+    expect(x.compareEach(y), [for (var i = 0; i < 100; i++) xs[i].compareTo(ys[i])]);
+
+    final empty = Decimal128List(0);
+    expect(empty.sum(), Decimal128.zero);
+    expect(empty.min().isNaN, isTrue);
+    expect(empty.average().isNaN, isTrue);
+
+    x.sort();
+    expect(x, [...xs]..sort());
+  });
+
+  test('Decimal128 Dart fast paths match the native library', () {
+    final random = Random(42);
+    final ints = [
+      0, 1, -1, 10, -10, 1 << 31, -(1 << 31), 1 << 62, (1 << 63) - 1, -(1 << 63) + 1, -(1 << 63), //
+      for (var i = 0; i < 100; i++) random.nextInt(1 << 32) - (1 << 31),
+    ];
+    for (final i in ints) {
+      expect(bits(Decimal128.fromInt(i)), bits(fromNative(realmLib.realm_dart_decimal128_from_int64(i))));
+    }
+
+    final values = [
+      for (final i in ints) Decimal128.fromInt(i),
+      -Decimal128.zero,
+      Decimal128.nan,
+      -Decimal128.nan,
+      Decimal128.infinity,
+      Decimal128.negativeInfinity,
+      for (final s in ['1.25', '-3.50', '0.00', '-0.00', '1E+6111', '-1E-6176', '9999999999999999999999999999999999', '92233720368547758.07']) Decimal128.parse(s),
+      for (var i = 0; i < 50; i++) Decimal128.parse('${random.nextInt(100000) - 50000}.${random.nextInt(100).toString().padLeft(2, '0')}'),
+    ];
+
+    using((arena) {
+      final nativeValues = [for (final x in values) toNative(x, arena)];
+      for (var i = 0; i < values.length; i++) {
+        final x = values[i], nx = nativeValues[i];
+        expect(x.isNaN, realmLib.realm_dart_decimal128_is_nan(nx), reason: '$x');
+        expect(x.toInt(), realmLib.realm_dart_decimal128_to_int64(nx), reason: '$x');
+        expect(bits(-x), bits(fromNative(realmLib.realm_dart_decimal128_negate(nx))), reason: '-$x');
+        for (var j = 0; j < values.length; j++) {
+          final y = values[j], ny = nativeValues[j];
+          final reason = '$x, $y';
+          expect(x == y, realmLib.realm_dart_decimal128_equal(nx, ny), reason: reason);
+          expect(x < y, realmLib.realm_dart_decimal128_less_than(nx, ny), reason: reason);
+          expect(x > y, realmLib.realm_dart_decimal128_greater_than(nx, ny), reason: reason);
+          expect(x.compareTo(y), realmLib.realm_dart_decimal128_compare_to(nx, ny), reason: reason);
+          expect(bits(x + y), bits(fromNative(realmLib.realm_dart_decimal128_add(nx, ny))), reason: reason);
+          expect(bits(x - y), bits(fromNative(realmLib.realm_dart_decimal128_subtract(nx, ny))), reason: reason);
+          expect(bits(x * y), bits(fromNative(realmLib.realm_dart_decimal128_multiply(nx, ny))), reason: reason);
+        }
+      }
+    });
+  });
+
+  test('Decimal128 Dart fast paths sum and order like native calls', () {
+    const count = 10000;
+    final random = Random(42);
+    final values = [for (var i = 0; i < count; i++) Decimal128.fromInt(random.nextInt(1 << 32) - (1 << 31))];
+
+    using((arena) {
+      final nativeValues = [for (final x in values) toNative(x, arena)];
+
+      var dartSum = Decimal128.zero;
+      var dartOrder = 0;
+      for (var i = 1; i < count; i++) {
+        dartSum = dartSum + values[i];
+        dartOrder += values[i].compareTo(values[i - 1]);
+      }
+
+      var nativeSum = nativeValues[0];
+      nativeSum = realmLib.realm_dart_decimal128_subtract(nativeSum, nativeSum);
+      var nativeOrder = 0;
+      for (var i = 1; i < count; i++) {
+        nativeSum = realmLib.realm_dart_decimal128_add(nativeSum, nativeValues[i]);
+        nativeOrder += realmLib.realm_dart_decimal128_compare_to(nativeValues[i], nativeValues[i - 1]);
+      }
+
+      expect(dartSum, fromNative(nativeSum));
+      expect(dartOrder, nativeOrder);
+    });
+  });
+
+  test('Decimal128 decoding from realm_value_t matches the native copy', () {
+    using((arena) {
+      final realmValue = arena<realm_value_t>().ref;
+      realmValue.type = realm_value_type.RLM_TYPE_DECIMAL128;
+      for (final s in ['12345.6789', '-0.00', '1E+6111', 'NaN']) {
+        (Decimal128.parse(s) as native.Decimal128).copyTo(realmValue.values.decimal128);
+        final decoded = realmValue.toPrimitiveValue() as Decimal128;
+        expect(bits(decoded), bits(fromNative(realmLib.realm_dart_decimal128_copy(realmValue.values.decimal128))), reason: s);
+      }
+    });
+  });
 }
@@ -1344,4 +1344,39 @@ void main() {
     final result = school.branches.query(r'city = $0', [null]);
     expect(result.length, 2);
   });
+
+  test('RealmList aggregates', () {
+    final config = Configuration.local([School.schema, Student.schema]);
+    final realm = getRealm(config);
+    final school = realm.write(() => realm.add(School('School')));
+    final students = school.students;
+
+    expect(students.sum<int>('number'), 0);
+    expect(students.min<int>('number'), isNull);
+    expect(students.max<int>('yearOfBirth'), isNull);
+    expect(students.average<double>('number'), isNull);
+
+    final unknownYears = realm.write(() {
+      students.addAll([Student(1, yearOfBirth: 2000), Student(2), Student(3, yearOfBirth: 2004)]);
+      // not in the list, so not aggregated
+      realm.add(Student(4, yearOfBirth: 1990));
+      return realm.add(School('Unknown years', students: [Student(5), Student(6)])).students;
+    });
+
+    expect(students.sum<int>('number'), 6);
+    expect(students.min<int>('number'), 1);
+    expect(students.max<int>('number'), 3);
+    expect(students.average<double>('number'), 2.0);
+
+    // null values are skipped
+    expect(students.sum<int>('yearOfBirth'), 4004);
+    expect(students.min<int>('yearOfBirth'), 2000);
+    expect(students.max<int>('yearOfBirth'), 2004);
+    expect(students.average<double>('yearOfBirth'), 2002.0);
+
+    expect(unknownYears.sum<int>('yearOfBirth'), 0);
+    expect(unknownYears.min<int>('yearOfBirth'), isNull);
+    expect(unknownYears.max<int>('yearOfBirth'), isNull);
+    expect(unknownYears.average<double>('yearOfBirth'), isNull);
+  });
 }
@@ -438,6 +438,27 @@ void main() {
     expect(() => newPlayers.handle.released, throws<RealmClosedError>());
   });
 
+  test('Migration releases the native objects of the handles it created', () {
+    final v1Config = Configuration.local([Person.schema, Team.schema], schemaVersion: 1);
+    final v1Realm = getRealm(v1Config);
+    v1Realm.write(() => v1Realm.addAll(List.generate(1000, (i) => Team('team $i'))));
+    v1Realm.close();
+
+    final touched = <Team>[];
+    late int liveInMigration;
+    final v2Config = Configuration.local([Person.schema, Team.schema], schemaVersion: 2, migrationCallback: (migration, oldSchemaVersion) {
+      final teams = migration.newRealm.all<Team>();
+      touched.addAll(List.generate(teams.length, (i) => teams[i]));
+      liveInMigration = Realm.diagnostics.handles['object']!.liveCount;
+    });
+
+    getRealm(v2Config);
+
+    // the Dart handles are still reachable, but their native objects are gone
+    expect(Realm.diagnostics.handles['object']!.liveCount, lessThanOrEqualTo(liveInMigration - touched.length));
+    expect(() => touched.first.name, throws<RealmClosedError>());
+  });
+
   test('LocalConfiguration.shouldDeleteIfMigrationNeeded deletes Realm', () {
     final config = Configuration.local([PersonIntName.schema]);
     final realm = getRealm(config);
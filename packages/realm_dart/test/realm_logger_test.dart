@@ -2,13 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 
 import 'dart:async';
+import 'dart:convert';
 import 'dart:isolate';
 import 'package:logging/logging.dart' hide LogRecord;
 import 'package:logging/logging.dart' as logging show LogRecord;
+import 'package:path/path.dart' as p;
 import 'package:realm_dart/src/logging.dart';
 import 'package:realm_dart/src/handles/realm_core.dart';
 import 'package:realm_dart/realm.dart';
 import 'test.dart';
+import 'utils/platform_util.dart';
 
 typedef DartLogRecord = logging.LogRecord;
 
@@ -68,6 +71,19 @@ void main() {
     });
   });
 
+  test('Log levels are per isolate', () async {
+    Realm.logger.setLogLevel(LogLevel.off);
+    Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
+
+    expectLater(Realm.logger.onRecord, emits(isA<LogRecord>().having((r) => r.message, 'message', 'Hey')));
+    await Isolate.run(() {
+      final sub = Realm.logger.onRecord.listen((_) {});
+      Realm.logger.setLogLevel(LogLevel.off, category: LogCategory.realm.sdk);
+      Realm.logger.log(LogLevel.trace, 'Hey');
+      return sub.cancel();
+    });
+  });
+
   test('Trace in root isolate seen in subisolate', () async {
     Realm.logger.setLogLevel(LogLevel.off);
     Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
@@ -80,6 +96,17 @@ void main() {
     Realm.logger.log(LogLevel.trace, 'Hey');
   });
 
+  test('Levels set in one isolate do not hide records from an isolate without levels', () async {
+    Realm.logger.setLogLevel(LogLevel.off);
+
+    final error = Isolate.run(() async {
+      return (await Realm.logger.onRecord.first).message;
+    });
+    await Future<void>.delayed(const Duration(milliseconds: 100)); // yield
+    expectLater(error, completion('Hey'));
+    Realm.logger.log(LogLevel.error, 'Hey');
+  });
+
   test('RealmLogger hookup logging', () async {
     Realm.logger.setLogLevel(LogLevel.off);
     Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
@@ -138,6 +165,65 @@ void main() {
     }
   });
 
+  test('RealmLogger delivers batched records in order', () async {
+    Realm.logger.setLogLevel(LogLevel.off);
+    Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
+
+    final messages = [for (var i = 0; i < 1000; i++) '$i: æøå 🙂 ${'x' * (i % 7)}'];
+    expectLater(
+      Realm.logger.onRecord.map((r) => (r.category, r.level, r.message)),
+      emitsInOrder([for (final m in messages) (LogCategory.realm.sdk, LogLevel.info, m)]),
+    );
+    for (final m in messages) {
+      Realm.logger.log(LogLevel.info, m);
+    }
+  });
+
+  test('RealmLogger accounts for every record under overload', () async {
+    Realm.logger.setLogLevel(LogLevel.off);
+    Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
+
+    const count = 20000;
+    final tag = Uuid.v4().toString();
+    final droppedBefore = Realm.logger.droppedRecordCount;
+    var received = 0;
+    final sub = Realm.logger.onRecord.listen((r) {
+      if (r.message.startsWith(tag)) received++;
+    });
+
+    for (var i = 0; i < count; i++) {
+      Realm.logger.log(LogLevel.trace, '$tag $i');
+    }
+
+    await waitForCondition(() => received + Realm.logger.droppedRecordCount - droppedBefore == count);
+    await sub.cancel();
+  });
+
+  test('RealmLogger file sink filters and rotates', () async {
+    Realm.logger.setLogLevel(LogLevel.off);
+    Realm.logger.setLogLevel(LogLevel.all, category: LogCategory.realm.sdk);
+
+    final path = p.join(platformUtil.createTempPathSync(), 'realm.log');
+    Future<String> read(String path) async => utf8.decode(await platformUtil.readAsBytes(path), allowMalformed: true);
+
+    Realm.logger.attachFileSink(path, maxFileSize: 1024, maxFileCount: 2, levels: {LogCategory.realm.sdk: LogLevel.info});
+    try {
+      Realm.logger.log(LogLevel.debug, 'filtered');
+      for (var i = 0; i < 100; i++) {
+        Realm.logger.log(LogLevel.info, 'message $i');
+      }
+
+      await waitForConditionWithResult(() => read(path), (text) => text.contains('message 99'));
+      final rotated = await read('$path.1');
+      expect(rotated, contains('Realm.SDK'));
+      expect(rotated, contains('message'));
+      expect(rotated + await read(path), isNot(contains('filtered')));
+      await expectLater(read('$path.2'), throwsA(anything));
+    } finally {
+      Realm.logger.detachFileSink();
+    }
+  });
+
   test('RealmLogger.onRecord is a broadcast stream', () {
     // see https://github.com/realm/realm-dart/pull/1574#issuecomment-2006769321
     expect(Realm.logger.onRecord.isBroadcast, isTrue);
@@ -903,4 +903,34 @@ void main() {
     var result = testSets.objectsSet.query(r'color = $0', [null]);
     expect(result.length, 2);
   });
+
+  test('RealmSet aggregates', () {
+    final config = Configuration.local([TestRealmSets.schema, Car.schema]);
+    final realm = getRealm(config);
+    final testSets = realm.write(() => realm.add(TestRealmSets(1)));
+    final cars = testSets.objectsSet;
+
+    expect(cars.sum<int>('year'), 0);
+    expect(cars.min<int>('year'), isNull);
+    expect(cars.max<int>('year'), isNull);
+    expect(cars.average<double>('year'), isNull);
+
+    final unknownYears = realm.write(() {
+      cars.addAll([Car('Tesla', year: 2020), Car('VW'), Car('Audi', year: 2010)]);
+      // not in the set, so not aggregated
+      realm.add(Car('Volvo', year: 1990));
+      return realm.add(TestRealmSets(2)..objectsSet.addAll([Car('Ford'), Car('Fiat')])).objectsSet;
+    });
+
+    // null values are skipped
+    expect(cars.sum<int>('year'), 4030);
+    expect(cars.min<int>('year'), 2010);
+    expect(cars.max<int>('year'), 2020);
+    expect(cars.average<double>('year'), 2015.0);
+
+    expect(unknownYears.sum<int>('year'), 0);
+    expect(unknownYears.min<int>('year'), isNull);
+    expect(unknownYears.max<int>('year'), isNull);
+    expect(unknownYears.average<double>('year'), isNull);
+  });
 }
@@ -1238,6 +1238,23 @@ void main() {
     expect(realm.isClosed, false);
   });
 
+  baasTest('Realm.open (flexibleSync) - native event loop', (appConfiguration) async {
+    final app = App(appConfiguration);
+    final credentials = Credentials.anonymous();
+    final user = await app.logIn(credentials);
+    final configuration = Configuration.flexibleSync(user, getSyncSchema(), openOnNativeEventLoop: true);
+
+    final realm = await getRealmAsync(configuration);
+    expect(realm.isClosed, false);
+
+    // The realm is usable on the isolate, even though it was opened on the event loop
+    final id = ObjectId();
+    realm.subscriptions.update((mutableSubscriptions) => mutableSubscriptions.add(realm.query<Product>(r'_id == $0', [id])));
+    await realm.subscriptions.waitForSynchronization();
+    realm.write(() => realm.add(Product(id, 'native event loop')));
+    expect(realm.find<Product>(id)?.name, 'native event loop');
+  });
+
   test('Realm.open (local)', () async {
     final configuration = Configuration.local([Car.schema]);
     final realm = await getRealmAsync(configuration);
@@ -1963,6 +1980,70 @@ void main() {
     expect(() => getRealm(config), returnsNormally);
   });
 
+  test('Realm.scope releases the handles obtained in it unless they escape', () {
+    final config = Configuration.local([Team.schema, Person.schema]);
+    final realm = getRealm(config);
+    realm.write(() => realm.addAll(List.generate(100, (i) => Team('team $i'))));
+
+    late int liveInScope;
+    late Team released;
+    late Team borrowed;
+    late Team escaped;
+    late Team nested;
+    late RealmResults<Team> results;
+    final returned = realm.scope(() {
+      final teams = results = realm.all<Team>();
+      released = teams.first;
+      borrowed = teams.firstWhere((t) => t.name == 'team 7');
+      escaped = realm.escape(teams.last);
+      // escaping an inner scope only moves the object to the outer one
+      final inner = realm.scope(() => teams[1]);
+      nested = realm.escape(inner);
+      final result = teams.query('name == "team 42"').single;
+      liveInScope = Realm.diagnostics.handles['object']!.liveCount;
+      return result;
+    });
+
+    expect(() => released.name, throws<RealmClosedError>('Cannot access an object obtained in a Realm.scope that has ended'));
+    expect(() => borrowed.name, throws<RealmClosedError>('Cannot access an object obtained in a Realm.scope that has ended'));
+    expect(() => results.length, throws<RealmClosedError>('Cannot access Results obtained in a Realm.scope that has ended'));
+    expect(escaped.name, 'team 99');
+    expect(nested.name, 'team 1');
+    expect(returned.name, 'team 42');
+    expect(Realm.diagnostics.handles['object']!.liveCount, lessThan(liveInScope));
+    expect(realm.all<Team>().length, 100);
+  });
+
+  test('Realm.diagnostics counts created handles and samples where they are allocated', () {
+    final config = Configuration.local([Team.schema, Person.schema]);
+    final realm = getRealm(config);
+    realm.write(() => realm.addAll(List.generate(10, (i) => Team('team $i'))));
+
+    final diagnostics = Realm.diagnostics;
+    final before = diagnostics.handles['object']!;
+    final teams = realm.all<Team>();
+    final kept = [for (var i = 0; i < 10; i++) teams[i]];
+    final after = diagnostics.handles['object']!;
+    expect(after.createdCount - before.createdCount, 10);
+    expect(after.liveCount, greaterThanOrEqualTo(10));
+
+    diagnostics.allocationSampleInterval = 2;
+    try {
+      realm.scope(() {
+        final sampled = [for (var i = 0; i < 10; i++) teams[i]];
+        final samples = diagnostics.allocationSamples.where((s) => s.type == 'object').toList();
+        expect(samples.length, greaterThanOrEqualTo(5));
+        expect(samples.first.stackTrace.toString(), contains('realm_test.dart'));
+        expect(sampled.length, kept.length);
+      });
+
+      // released handles are no longer reported
+      expect(diagnostics.allocationSamples.where((s) => s.type == 'object'), isEmpty);
+    } finally {
+      diagnostics.allocationSampleInterval = 0;
+    }
+  });
+
   baasTest('Sync realm with orphaned embedded objects, throws', (appConfig) async {
     final user = await getIntegrationUser(appConfig: appConfig);
     final config = Configuration.flexibleSync(user, [Task.schema, AllTypesEmbedded.schema])..sessionStopPolicy = SessionStopPolicy.immediately;
@@ -719,6 +719,94 @@ void main() {
     expect(list.length, teams.length);
   });
 
+  test('Results iteration borrows objects and promotes the ones used afterwards', () {
+    var config = Configuration.local([Team.schema, Person.schema]);
+    var realm = getRealm(config);
+
+    // more than fit in one slab of borrowed objects
+    const count = 600;
+    realm.write(() {
+      realm.addAll(List.generate(count, (i) => Team("team $i")));
+    });
+
+    final teams = realm.all<Team>();
+    final kept = <Team>[];
+    late Team untouched;
+    var i = 0;
+    for (final team in teams) {
+      expect(team.name, "team $i");
+      if (i % 100 == 0) {
+        kept.add(team);
+      }
+      if (i == 1) {
+        untouched = team;
+      }
+      i++;
+    }
+    expect(i, count);
+
+    // the slabs are released by now, so these are looked up again
+    for (var j = 0; j < kept.length; j++) {
+      expect(kept[j].name, "team ${j * 100}");
+      expect(kept[j].isValid, isTrue);
+      expect(kept[j], teams[j * 100]);
+    }
+
+    // a borrowed object deleted before it is looked up again is no longer valid
+    realm.write(() => realm.delete(teams[1]));
+    expect(untouched.isValid, isFalse);
+    expect(kept.last.isValid, isTrue);
+
+    expect(teams.toList().map((t) => t.name), isNot(contains("team 1")));
+  });
+
+  test('Results iteration does not resolve a borrowed object to one recreated with its primary key', () {
+    var config = Configuration.local([Dog.schema, Person.schema]);
+    var realm = getRealm(config);
+
+    realm.write(() {
+      realm.addAll(List.generate(10, (i) => Dog("dog $i", age: i)));
+    });
+
+    late Dog borrowed;
+    for (final dog in realm.all<Dog>()) {
+      if (dog.name == "dog 5") {
+        borrowed = dog;
+      }
+    }
+
+    realm.write(() => realm.delete(realm.find<Dog>("dog 5")!));
+    expect(borrowed.isValid, isFalse);
+
+    final recreated = realm.write(() => realm.add(Dog("dog 5", age: 50)));
+    expect(recreated.isValid, isTrue);
+    expect(borrowed.isValid, isFalse);
+    expect(borrowed, isNot(recreated));
+    expect(() => borrowed.age, throws<RealmException>("Accessing object of type Dog which has been invalidated or deleted"));
+  });
+
+  test('Realm.diagnostics.handles counts the rows held by evaluated results', () {
+    var config = Configuration.local([Team.schema, Person.schema]);
+    var realm = getRealm(config);
+
+    const count = 10000;
+    realm.write(() {
+      realm.addAll(List.generate(count, (i) => Team("team $i")));
+    });
+
+    expect(Realm.diagnostics.handles['realm']!.liveCount, greaterThan(0));
+
+    final teams = realm.query<Team>(r'name BEGINSWITH $0', ["team"]);
+    final before = Realm.diagnostics.handles['results']!;
+
+    // iterating takes a snapshot of the results, which holds the key of every row
+    final iterator = teams.iterator;
+    final after = Realm.diagnostics.handles['results']!;
+    expect(after.liveCount, before.liveCount + 1);
+    expect(after.liveBytes - before.liveBytes, greaterThanOrEqualTo(count * 8));
+    expect(iterator.moveNext(), isTrue);
+  });
+
   test('Results query', () {
     var config = Configuration.local([Car.schema]);
     var realm = getRealm(config);
@@ -1550,4 +1638,36 @@ void main() {
     expect(results.skip(2), results.toList().sublist(2));
     expect(results.skip(2).take(3), [results[2], results[3], results[4]]);
   });
+
+  test('RealmResults aggregates', () {
+    final config = Configuration.local([AllTypes.schema]);
+    final realm = getRealm(config);
+    final results = realm.all<AllTypes>();
+
+    expect(results.sum<int>('intProp'), 0);
+    expect(results.min<int>('intProp'), isNull);
+    expect(results.average<double>('doubleProp'), isNull);
+
+    realm.write(() {
+      for (var i = 1; i <= 4; i++) {
+        realm.add(AllTypes('', false, DateTime.utc(2024, i), i * 0.5, ObjectId(), Uuid.v4(), i, Decimal128.fromInt(i * 10), Uint8List(0)));
+      }
+    });
+
+    expect(results.sum<int>('intProp'), 10);
+    expect(results.min<int>('intProp'), 1);
+    expect(results.max<int>('intProp'), 4);
+    expect(results.average<double>('intProp'), 2.5);
+    expect(results.sum<double>('doubleProp'), 5.0);
+    expect(results.sum<Decimal128>('decimalProp'), Decimal128.fromInt(100));
+    expect(results.min<Decimal128>('decimalProp'), Decimal128.fromInt(10));
+    expect(results.average<Decimal128>('decimalProp'), Decimal128.fromInt(25));
+    expect(results.min<DateTime>('dateProp'), DateTime.utc(2024, 1));
+    expect(results.max<DateTime>('dateProp'), DateTime.utc(2024, 4));
+    expect(results.query('intProp > 2').sum<int>('intProp'), 7);
+
+    expect(() => results.sum<int>('stringProp'), throws<RealmException>());
+    expect(() => results.sum<int>('noSuchProp'), throws<RealmException>());
+    expect(() => results.skip(1).sum<int>('intProp'), throws<RealmStateError>());
+  });
 }
@@ -0,0 +1,97 @@
+// Copyright 2026 MongoDB, Inc.
+// SPDX-License-Identifier: Apache-2.0
+
+import 'dart:io';
+
+import 'package:realm_dart/realm.dart';
+import 'package:realm_dart/src/scheduler.dart';
+
+import 'test.dart';
+
+void main() {
+  setupTests();
+
+  test('Scheduler coalesces wake-ups', () async {
+    final realm = getRealm(Configuration.local([Car.schema]));
+    final before = scheduler.handle.stats;
+
+    final changes = <RealmResultsChanges<Car>>[];
+    final subscription = realm.all<Car>().changes.listen(changes.add);
+    for (var i = 0; i < 10; i++) {
+      await realm.writeAsync(() => realm.add(Car('Car $i')));
+    }
+    await waitForCondition(() => changes.isNotEmpty && changes.last.results.length == 10);
+    await subscription.cancel();
+
+    final after = scheduler.handle.stats;
+    final notifies = after.notifyCount - before.notifyCount;
+    final posts = after.postCount - before.postCount;
+    expect(notifies, greaterThan(0));
+    expect(posts, inInclusiveRange(1, notifies));
+    expect(after.coalescedCount - before.coalescedCount, notifies - posts);
+    expect(after.drainedCount - before.drainedCount, notifies);
+  });
+
+  test('Scheduler.stats reports latencies', () async {
+    final realm = getRealm(Configuration.local([Car.schema]));
+    final before = scheduler.stats;
+
+    await realm.writeAsync(() => realm.add(Car('Tesla')));
+
+    final stats = scheduler.stats;
+    expect(stats.invokeCount, greaterThan(before.invokeCount));
+    expect(stats.latencyMax, greaterThanOrEqualTo(stats.latencyP99));
+    expect(stats.latencyP99, greaterThanOrEqualTo(stats.latencyP50));
+  });
+
+  test('Scheduler drain budget still delivers all work', () async {
+    Realm.schedulerDrainBudget = const Duration(microseconds: 1);
+    addTearDown(() => Realm.schedulerDrainBudget = null);
+
+    // every instance of the realm is notified of a write, so one write queues several notifications
+    final config = Configuration.local([Car.schema]);
+    final realms = [for (var i = 0; i < 5; i++) getRealm(config)];
+
+    final lengths = [for (final _ in realms) <int>[]];
+    final subscriptions = [
+      for (var i = 0; i < realms.length; i++) realms[i].all<Car>().changes.listen((c) => lengths[i].add(c.results.length)),
+    ];
+    await waitForCondition(() => lengths.every((l) => l.isNotEmpty));
+
+    final before = scheduler.handle.stats;
+    for (var i = 0; i < 10; i++) {
+      realms.first.write(() => realms.first.add(Car('Car $i')));
+      // keep the isolate busy until the notifications of the write are queued, so they are drained together
+      sleep(const Duration(milliseconds: 20));
+      await waitForCondition(() => lengths.every((l) => l.last == i + 1));
+    }
+    for (final s in subscriptions) {
+      await s.cancel();
+    }
+
+    final after = scheduler.handle.stats;
+    expect(after.drainedCount, greaterThan(before.drainedCount));
+    expect(after.deferredCount, greaterThan(before.deferredCount));
+    // every listener saw the initial results and then every write, in order
+    for (final l in lengths) {
+      expect(l, [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10]);
+    }
+  });
+
+  test('Scheduler drain budget must be positive', () {
+    expect(() => Realm.schedulerDrainBudget = Duration.zero, throwsArgumentError);
+    expect(Realm.schedulerDrainBudget, isNull);
+  });
+
+  test('Scheduler lanes drain when idle', () async {
+    final realm = getRealm(Configuration.local([Car.schema]));
+    final subscription = realm.all<Car>().changes.listen((_) {});
+    realm.write(() => realm.add(Car('Tesla')));
+    Realm.logger.log(LogLevel.error, 'lane depth');
+    await realm.refreshAsync();
+    await Future<void>.delayed(const Duration(milliseconds: 100));
+    await subscription.cancel();
+
+    expect(scheduler.laneDepths, (notifications: 0, callbacks: 0, logs: 0));
+  });
+}
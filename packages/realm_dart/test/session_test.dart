@@ -2,8 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 
 import 'dart:async';
+import 'dart:ffi';
 import 'package:test/test.dart' hide test, throws;
 import 'package:realm_dart/realm.dart';
+import 'package:realm_dart/src/handles/native/realm_library.dart';
+import 'package:realm_dart/src/handles/native/scheduler_handle.dart';
+import 'package:realm_dart/src/handles/native/session_handle.dart';
+import 'package:realm_dart/src/session.dart' show ProgressNotificationsController;
 import 'test.dart';
 
 Future<void> validateSessionStates(String validationName, Session session,
@@ -156,9 +161,9 @@ void main() {
     expect(realmA.all<NullableTypes>().map((e) => e.stringProp), realmB.all<NullableTypes>().map((e) => e.stringProp));
   });
 
-  StreamProgressData subscribeToProgress(Realm realm, ProgressDirection direction, ProgressMode mode) {
+  StreamProgressData subscribeToProgress(Realm realm, ProgressDirection direction, ProgressMode mode, {Duration interval = Duration.zero}) {
     final data = StreamProgressData();
-    final stream = realm.syncSession.getProgressStream(direction, mode);
+    final stream = realm.syncSession.getProgressStream(direction, mode, interval: interval);
 
     data.subscription = stream.listen((event) {
       if (mode == ProgressMode.forCurrentlyOutstandingWork) {
@@ -233,6 +238,64 @@ void main() {
     await downloadData.subscription.cancel();
   });
 
+  baasTest('SyncSession.getProgressStream with interval coalesces updates', (configuration) async {
+    const interval = Duration(milliseconds: 200);
+    final differentiator = ObjectId();
+    final realm = await getIntegrationRealm(differentiator: differentiator);
+
+    realm.write(() {
+      for (var i = 0; i < 500; i++) {
+        realm.add(NullableTypes(ObjectId(), differentiator, stringProp: generateRandomString(1000)));
+      }
+    });
+
+    final deliveries = <(Duration, double)>[];
+    final stopwatch = Stopwatch()..start();
+    final data = subscribeToProgress(realm, ProgressDirection.upload, ProgressMode.forCurrentlyOutstandingWork, interval: interval);
+    data.subscription.onData((event) => deliveries.add((stopwatch.elapsed, event.progressEstimate)));
+    data.subscription.onDone(() => data.doneInvoked = true);
+
+    await realm.syncSession.waitForUpload();
+    await Future<void>.delayed(const Duration(milliseconds: 100));
+
+    // the completion is always delivered, and everything before it is at least the interval apart
+    expect(deliveries, isNotEmpty);
+    expect(deliveries.last.$2, 1.0);
+    expect(data.doneInvoked, isTrue);
+    for (var i = 1; i < deliveries.length - 1; i++) {
+      expect(deliveries[i].$1 - deliveries[i - 1].$1, greaterThanOrEqualTo(interval - const Duration(milliseconds: 20)));
+    }
+
+    expect(() => realm.syncSession.getProgressStream(ProgressDirection.upload, ProgressMode.reportIndefinitely, interval: const Duration(seconds: -1)),
+        throwsArgumentError);
+  });
+
+  test('Progress ticks folded within the interval deliver the latest one once it passes', () async {
+    const interval = Duration(milliseconds: 200);
+    final controller = _RecordingProgressController();
+    final callback = Pointer.fromFunction<Void Function(Handle, Uint64, Uint64, Double)>(syncProgressCallback);
+    final userdata = realmLib.realm_dart_sync_progress_userdata_new(controller, callback.cast(), schedulerHandle.callbacksPointer, interval.inMilliseconds).cast<Void>();
+    try {
+      realmLib.realm_dart_sync_progress_callback(userdata, 10, 100, 0.1);
+      await waitForCondition(() => controller.estimates.length == 1);
+
+      // both are folded, and only the latest is delivered once the interval has passed
+      realmLib.realm_dart_sync_progress_callback(userdata, 20, 100, 0.2);
+      realmLib.realm_dart_sync_progress_callback(userdata, 30, 100, 0.3);
+      await Future<void>.delayed(interval ~/ 2);
+      expect(controller.estimates, [0.1]);
+      await waitForCondition(() => controller.estimates.length == 2);
+      expect(controller.estimates, [0.1, 0.3]);
+
+      // the tick completing the transfer doesn't wait for the interval
+      realmLib.realm_dart_sync_progress_callback(userdata, 100, 100, 1.0);
+      await waitForCondition(() => controller.estimates.length == 3, timeout: interval ~/ 2, retryDelay: const Duration(milliseconds: 10));
+      expect(controller.estimates.last, 1.0);
+    } finally {
+      realmLib.realm_dart_sync_progress_userdata_free(userdata);
+    }
+  });
+
   baasTest('SyncSession.getProgressStream after reconnecting', (configuration) async {
     final differentiator = ObjectId();
     final uploadRealm = await getIntegrationRealm(differentiator: differentiator);
@@ -395,3 +458,10 @@ class StreamProgressData {
   StreamProgressData.snapshot(StreamProgressData other)
       : this(callbacksInvoked: other.callbacksInvoked, doneInvoked: other.doneInvoked, progressEstimate: other.progressEstimate);
 }
+
+class _RecordingProgressController implements ProgressNotificationsController {
+  final estimates = <double>[];
+
+  @override
+  void onProgress(double progressEstimate) => estimates.add(progressEstimate);
+}
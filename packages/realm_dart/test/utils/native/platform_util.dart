@@ -1,6 +1,7 @@
 // Copyright 2024 MongoDB, Inc.
 // SPDX-License-Identifier: Apache-2.0
 
+import 'dart:convert';
 import 'dart:io';
 import 'dart:typed_data';
 
@@ -53,4 +54,32 @@ class PlatformUtil implements intf.PlatformUtil {
   
   @override
   int get minInt => -0x8000000000000000;
+
+  @override
+  Future<intf.LocalHttpServer> startLocalHttpServer(int statusCode, Object body, void Function(String path, int clientPort) onRequest) async {
+    final server = await HttpServer.bind(InternetAddress.loopbackIPv4, 0);
+    server.listen((request) async {
+      onRequest(request.uri.path, request.connectionInfo!.remotePort);
+      await request.drain<void>();
+      // written without a content length, so the response is chunked
+      request.response
+        ..statusCode = statusCode
+        ..headers.contentType = ContentType.json
+        ..write(jsonEncode(body));
+      await request.response.close();
+    });
+    return _LocalHttpServer(server);
+  }
+}
+
+class _LocalHttpServer implements intf.LocalHttpServer {
+  final HttpServer _server;
+
+  _LocalHttpServer(this._server);
+
+  @override
+  Uri get uri => Uri.parse('http://${_server.address.address}:${_server.port}');
+
+  @override
+  Future<void> close() => _server.close(force: true);
 }
@@ -24,6 +24,15 @@ abstract interface class PlatformUtil {
 
   int get maxInt;
   int get minInt;
+
+  /// Start an HTTP server on the loopback interface, answering every request with [statusCode] and [body] encoded as JSON.
+  /// [onRequest] is called with the path of each request and the port of the client connection it came over.
+  Future<LocalHttpServer> startLocalHttpServer(int statusCode, Object body, void Function(String path, int clientPort) onRequest);
+}
+
+abstract interface class LocalHttpServer {
+  Uri get uri;
+  Future<void> close();
 }
 
 const platformUtil = PlatformUtil();